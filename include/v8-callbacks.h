@@ -203,6 +203,17 @@ using PrintCurrentStackTraceFilterCallback =
 using NearHeapLimitCallback = size_t (*)(void* data, size_t current_heap_limit,
                                          size_t initial_heap_limit);
 
+/**
+ * This callback is invoked when the bytes allocated while a context was the
+ * current context exceed the limit set with
+ * Isolate::SetContextAllocationLimit(). It is invoked from an interrupt and
+ * may e.g. terminate execution or raise the limit. It is invoked at most once
+ * per limit.
+ */
+using ContextAllocationLimitCallback = void (*)(Local<Context> context,
+                                                size_t allocated_bytes,
+                                                void* data);
+
 /**
  * Callback function passed to SetUnhandledExceptionCallback.
  */
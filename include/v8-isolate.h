@@ -179,6 +179,30 @@ class V8_EXPORT ResourceConstraints {
  */
 enum class MemoryPressureLevel { kNone, kModerate, kCritical };
 
+/**
+ * Targets for the heap growing heuristics of an isolate, see
+ * Isolate::SetHeapGrowingTargets(). Latency-sensitive isolates set a small
+ * pause target, which makes V8 size the heap such that marking can finish
+ * concurrently and scavenges stay within the target while keeping the heap as
+ * small as possible. Throughput-oriented isolates set a large or no pause
+ * target, which keeps the default heuristics.
+ */
+struct HeapGrowingTargets {
+  /**
+   * Target for individual garbage collection pauses in milliseconds. Zero
+   * means no target.
+   */
+  double max_gc_pause_ms = 0;
+
+  /**
+   * Size in bytes the heap should stay below. Limits are computed such that
+   * garbage collections become more frequent when approaching the ceiling. In
+   * contrast to ResourceConstraints, exceeding the ceiling is not fatal. Zero
+   * means no ceiling.
+   */
+  size_t memory_ceiling_in_bytes = 0;
+};
+
 /**
  * Signal for dependants of contexts. Useful for
  * `ContextDisposedNotification()` to implement different strategies.
@@ -877,6 +901,13 @@ class V8_EXPORT Isolate {
    */
   void SetMemorySaverMode(bool memory_saver_mode_enabled);
 
+  /**
+   * Sets the targets the heap growing heuristics of this isolate optimize for.
+   * Takes effect with the next garbage collection. Passing default-constructed
+   * targets restores the default heuristics.
+   */
+  void SetHeapGrowingTargets(const HeapGrowingTargets& targets);
+
   /**
    * Drop non-essential caches. Should only be called from testing code.
    * The method can potentially block for a long time and does not necessarily
@@ -1060,6 +1091,34 @@ class V8_EXPORT Isolate {
       std::unique_ptr<MeasureMemoryDelegate> delegate,
       MeasureMemoryExecution execution = MeasureMemoryExecution::kDefault);
 
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Starts accounting the bytes that are allocated on the main thread while
+   * the given context is the current context, and sets a soft limit for them.
+   * Allocations are attributed at a sampling granularity of a few dozen
+   * kilobytes. Accounting stops when the context is garbage collected.
+   *
+   * \param limit_in_bytes the number of allocated bytes at which the callback
+   *   set with SetContextAllocationLimitCallback() is invoked. Setting the
+   *   limit again re-arms the callback. 0 only enables accounting.
+   */
+  void SetContextAllocationLimit(Local<Context> context, size_t limit_in_bytes);
+
+  /**
+   * Returns the bytes allocated while the given context was the current
+   * context since SetContextAllocationLimit() was first called for it, or 0
+   * if the context is not accounted.
+   */
+  size_t GetContextAllocatedBytes(Local<Context> context);
+
+  /**
+   * Sets the callback that is invoked when a context exceeds the limit set
+   * with SetContextAllocationLimit().
+   */
+  void SetContextAllocationLimitCallback(
+      ContextAllocationLimitCallback callback, void* data);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -5,18 +5,30 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
 #include <optional>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
+#include "v8-memory-span.h"   // NOLINT(build/include_directory)
 #include "v8-message.h"       // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class Isolate;
+class OutputStream;
 class Value;
 class String;
 
+namespace internal {
+class JsonIncrementalParser;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
@@ -37,6 +49,23 @@ class V8_EXPORT JSON {
       Local<Context> context, Local<String> json_string,
       std::optional<ScriptOrigin> origin = std::nullopt);
 
+  /**
+   * Tries to parse the UTF-8 encoded bytes |json_utf8| like Parse, without
+   * creating a string of the whole input first. ASCII input is parsed in
+   * place; the bytes only need to stay alive and unchanged for the duration
+   * of the call, so they may for example point into the backing store of an
+   * ArrayBuffer. Other input is decoded into a string before parsing, and
+   * invalid UTF-8 sequences are replaced with U+FFFD.
+   *
+   * \param the context in which to parse and create the value.
+   * \param json_utf8 The UTF-8 encoded bytes to parse.
+   * \param origin Optional script origin to use for error reporting.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
+      Local<Context> context, MemorySpan<const uint8_t> json_utf8,
+      std::optional<ScriptOrigin> origin = std::nullopt);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -47,6 +76,93 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Tries to stringify the JSON-serializable object |json_object| like
+   * Stringify, but writes the UTF-8 encoded result to |stream| in chunks of at
+   * most stream->GetChunkSize() bytes instead of creating a string. Although
+   * the chunks are passed to OutputStream::WriteAsciiChunk, they contain UTF-8
+   * and thus non-ASCII bytes if the result has non-ASCII characters. Lone
+   * surrogates coming from the gap or from raw JSON are written as U+FFFD.
+   *
+   * Output is handed to the stream between serializing values, where the
+   * stream may call back into V8. Only a bounded amount of output is buffered
+   * at a time, apart from single values such as long strings or arrays of
+   * numbers, which are buffered whole.
+   *
+   * EndOfStream is called once the whole result has been written. Nothing is
+   * written for values that stringify to undefined. If an exception is thrown
+   * or the stream returns kAbort, EndOfStream is not called.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream the result is written to.
+   * \return Nothing if an exception was thrown, false if the stream aborted
+   * writing, true otherwise.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> Stringify(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
+};
+
+/**
+ * Parses JSON text that arrives in pieces, e.g. from the network, in steps
+ * that each stay within a time and byte budget. This allows parsing a large
+ * text in between other work on the same thread. The partial result is kept
+ * on the heap between steps.
+ *
+ * Syntax errors are reported as SyntaxErrors like by JSON::Parse. Their
+ * positions count UTF-8 bytes, and positions of errors inside a string or
+ * number, or inside a small object or array that is parsed in one step, are
+ * relative to the start of that value.
+ */
+class V8_EXPORT JSONIncrementalParser {
+ public:
+  enum class Status {
+    // All appended input was parsed, call Append or Finish and Parse again.
+    kNeedsInput,
+    // The budget was used up, call Parse again.
+    kYielded,
+    // The whole text was parsed, see GetResult.
+    kDone,
+  };
+
+  explicit JSONIncrementalParser(Isolate* isolate);
+  ~JSONIncrementalParser();
+  JSONIncrementalParser(const JSONIncrementalParser&) = delete;
+  JSONIncrementalParser& operator=(const JSONIncrementalParser&) = delete;
+
+  /**
+   * Appends the next piece of UTF-8 encoded input. Pieces may split tokens
+   * and characters anywhere. The bytes are copied.
+   */
+  void Append(MemorySpan<const uint8_t> json_utf8);
+
+  /**
+   * Signals that all input was appended.
+   */
+  void Finish();
+
+  /**
+   * Parses the appended input until it is used up, roughly
+   * |time_budget_in_ms| milliseconds passed or |byte_budget| bytes were
+   * parsed, or the whole text was parsed and Finish was called. All calls must
+   * use the same context.
+   *
+   * \return Nothing if an exception was thrown, after which the parser must
+   * not be used anymore.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<Status> Parse(Local<Context> context,
+                                            double time_budget_in_ms,
+                                            size_t byte_budget = SIZE_MAX);
+
+  /**
+   * Returns the parsed value once Parse returned kDone.
+   */
+  Local<Value> GetResult();
+
+ private:
+  Isolate* const isolate_;
+  std::unique_ptr<internal::JsonIncrementalParser> impl_;
 };
 
 }  // namespace v8
@@ -228,6 +228,13 @@ class V8_EXPORT CpuProfile {
    */
   int GetSamplesCount() const;
 
+  /**
+   * Returns the number of samples that were taken while the profile was
+   * recording but lost because the profiler's tick buffer was full, see
+   * --cpu-profiler-tick-buffer-size.
+   */
+  int GetDroppedSamplesCount() const;
+
   /**
    * Returns profile node corresponding to the top frame the sample at
    * the given index.
@@ -638,7 +645,8 @@ class V8_EXPORT HeapGraphNode {
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // See format description near 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -688,6 +696,25 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format is a sequence of records made of unsigned LEB128
+   * varints, written through OutputStream::WriteAsciiChunk even though the
+   * bytes are not ASCII. It starts with the bytes "V8HS" and a format
+   * version (currently 1), followed by records that each start with a tag:
+   *
+   *  0: end of snapshot
+   *  1: string: length, then that many bytes of UTF-8
+   *  2: edge: from node index, type, name string id or element index,
+   *     to node index
+   *  3: node: type, name string id, id, self_size, trace_node_id,
+   *     detachedness
+   *  4: location: node index, script id, line, column
+   *
+   * Strings are numbered from 0 in the order their records appear and are
+   * always written before the first record that uses them. Nodes are
+   * numbered from 0 in the order their records appear, but edges may refer
+   * to nodes that are written later. Edges are not grouped by their source
+   * node. Allocation traces and samples are not part of the binary format.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -811,6 +838,20 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * Number of garbage collections the sampled object has survived so far,
+     * or had survived when it was collected.
+     */
+    uint32_t survived_gcs = 0;
+
+    /**
+     * False if the sampled object has been collected. Such samples are only
+     * reported when kSamplingIncludeObjectsCollectedByMajorGC or
+     * kSamplingIncludeObjectsCollectedByMinorGC is set, or by
+     * HeapProfiler::GetAllocationProfileDelta().
+     */
+    bool is_live = true;
   };
 
   /**
@@ -1145,6 +1186,18 @@ class V8_EXPORT HeapProfiler {
   const HeapSnapshot* TakeHeapSnapshot(
       const HeapSnapshotOptions& options = HeapSnapshotOptions());
 
+  /**
+   * Takes a heap snapshot and writes it to |stream| in the
+   * HeapSnapshot::kBinary format while it is being generated. Edges are
+   * written out as soon as they are discovered instead of being kept in
+   * memory, and no HeapSnapshot is retained afterwards, so this needs far
+   * less memory than TakeHeapSnapshot() followed by Serialize(). Returns
+   * false if generation was interrupted or the stream aborted.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream,
+      const HeapSnapshotOptions& options = HeapSnapshotOptions());
+
   /**
    * Takes a heap snapshot. See `HeapSnapshotOptions` for details on the
    * parameters.
@@ -1248,6 +1301,16 @@ class V8_EXPORT HeapProfiler {
    */
   AllocationProfile* GetAllocationProfile();
 
+  /**
+   * Like GetAllocationProfile(), but the samples only describe what changed
+   * since the previous call to this method: samples recorded since then, and
+   * samples reported earlier whose objects have been collected since then,
+   * with |is_live| set to false. The call-graph still describes all live
+   * samples, so it can be exported periodically to follow the live bytes
+   * per allocation stack over time. The first call reports all samples.
+   */
+  AllocationProfile* GetAllocationProfileDelta();
+
   /**
    * Deletes all snapshots taken. All previously returned pointers to
    * snapshots and their contents become invalid after this call.
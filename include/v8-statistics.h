@@ -154,6 +154,33 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the current capacity of the young generation.
+   */
+  size_t young_generation_capacity() { return young_generation_capacity_; }
+
+  /**
+   * Returns the young generation capacity the adaptive sizing policy aims for,
+   * or zero if the policy is disabled or has not collected enough data yet.
+   */
+  size_t young_generation_target_capacity() {
+    return young_generation_target_capacity_;
+  }
+
+  /**
+   * Returns the average fraction of young generation objects that survived
+   * recent young generation collections, in the range [0, 1].
+   */
+  double young_generation_survival_ratio() {
+    return young_generation_survival_ratio_;
+  }
+
+  /**
+   * Returns the number of bytes of dead heap pages and array buffer backing
+   * stores that are waiting to be released by background threads.
+   */
+  size_t pending_release_size() { return pending_release_size_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -175,6 +202,10 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t young_generation_capacity_;
+  size_t young_generation_target_capacity_;
+  double young_generation_survival_ratio_;
+  size_t pending_release_size_;
 
   friend class V8;
   friend class Isolate;
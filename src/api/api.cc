@@ -68,6 +68,7 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles-inl.h"
+#include "src/heap/context-allocation-tracker.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap-write-barrier.h"
@@ -77,6 +78,7 @@
 #include "src/init/icu_util.h"
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
+#include "src/json/json-incremental-parser.h"
 #include "src/json/json-parser.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters-scopes.h"
@@ -3216,13 +3218,10 @@ bool StackFrame::IsUserJavaScript() const {
 
 // --- J S O N ---
 
-MaybeLocal<Value> JSON::Parse(Local<Context> context, Local<String> json_string,
-                              std::optional<ScriptOrigin> origin) {
-  PrepareForExecutionScope api_scope{context, RCCId::kAPI_JSON_Parse};
-  i::Isolate* i_isolate = api_scope.i_isolate();
-  auto string = Utils::OpenHandle(*json_string);
-  i::Handle<i::String> source = i::String::Flatten(i_isolate, string);
-  i::Handle<i::Object> undefined = i_isolate->factory()->undefined_value();
+namespace {
+
+std::optional<i::ScriptDetails> GetJsonScriptDetails(
+    i::Isolate* i_isolate, const std::optional<ScriptOrigin>& origin) {
   std::optional<i::ScriptDetails> script_details;
   if (origin.has_value()) {
     const ScriptOrigin& script_origin = origin.value();
@@ -3231,6 +3230,20 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context, Local<String> json_string,
         script_origin.ColumnOffset(), script_origin.SourceMapUrl(),
         script_origin.GetHostDefinedOptions(), script_origin.Options()));
   }
+  return script_details;
+}
+
+}  // namespace
+
+MaybeLocal<Value> JSON::Parse(Local<Context> context, Local<String> json_string,
+                              std::optional<ScriptOrigin> origin) {
+  PrepareForExecutionScope api_scope{context, RCCId::kAPI_JSON_Parse};
+  i::Isolate* i_isolate = api_scope.i_isolate();
+  auto string = Utils::OpenHandle(*json_string);
+  i::Handle<i::String> source = i::String::Flatten(i_isolate, string);
+  i::Handle<i::Object> undefined = i_isolate->factory()->undefined_value();
+  std::optional<i::ScriptDetails> script_details =
+      GetJsonScriptDetails(i_isolate, origin);
   auto maybe_result = source->IsOneByteRepresentation()
                           ? i::JsonParser<uint8_t>::Parse(
                                 i_isolate, source, undefined, script_details)
@@ -3239,6 +3252,20 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context, Local<String> json_string,
   return api_scope.EscapeMaybe(maybe_result);
 }
 
+MaybeLocal<Value> JSON::Parse(Local<Context> context,
+                              MemorySpan<const uint8_t> json_utf8,
+                              std::optional<ScriptOrigin> origin) {
+  PrepareForExecutionScope api_scope{context, RCCId::kAPI_JSON_Parse};
+  i::Isolate* i_isolate = api_scope.i_isolate();
+  std::optional<i::ScriptDetails> script_details =
+      GetJsonScriptDetails(i_isolate, origin);
+  i::MaybeHandle<i::Object> maybe_result = i::JsonParseUtf8(
+      i_isolate,
+      base::Vector<const uint8_t>(json_utf8.data(), json_utf8.size()),
+      script_details);
+  return api_scope.EscapeMaybe(maybe_result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3263,6 +3290,67 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   return api_scope.EscapeMaybe(i::Object::ToString(i_isolate, maybe));
 }
 
+Maybe<bool> JSON::Stringify(Local<Context> context, Local<Value> json_object,
+                            OutputStream* stream, Local<String> gap) {
+  PrepareForExecutionScope api_scope{context, RCCId::kAPI_JSON_Stringify};
+  i::Isolate* i_isolate = api_scope.i_isolate();
+  i::Handle<i::JSAny> object;
+  if (!Utils::ApiCheck(
+          i::TryCast<i::JSAny>(Utils::OpenHandle(*json_object), &object),
+          "JSON::Stringify",
+          "Invalid object, must be a JSON-serializable object.") ||
+      !Utils::ApiCheck(stream != nullptr, "JSON::Stringify",
+                       "Invalid stream, must not be null.")) {
+    return Nothing<bool>();
+  }
+  i::Handle<i::Undefined> replacer = i_isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  return i::JsonStringifyToStream(i_isolate, object, replacer, gap_string,
+                                  stream);
+}
+
+JSONIncrementalParser::JSONIncrementalParser(Isolate* isolate)
+    : isolate_(isolate),
+      impl_(std::make_unique<i::JsonIncrementalParser>(
+          reinterpret_cast<i::Isolate*>(isolate))) {}
+
+JSONIncrementalParser::~JSONIncrementalParser() = default;
+
+void JSONIncrementalParser::Append(MemorySpan<const uint8_t> json_utf8) {
+  Utils::ApiCheck(!impl_->failed(), "JSONIncrementalParser::Append",
+                  "The parser failed");
+  impl_->Append(
+      base::Vector<const uint8_t>(json_utf8.data(), json_utf8.size()));
+}
+
+void JSONIncrementalParser::Finish() { impl_->Finish(); }
+
+Maybe<JSONIncrementalParser::Status> JSONIncrementalParser::Parse(
+    Local<Context> context, double time_budget_in_ms, size_t byte_budget) {
+  PrepareForExecutionScope api_scope{context, RCCId::kAPI_JSON_Parse};
+  Utils::ApiCheck(!impl_->failed(), "JSONIncrementalParser::Parse",
+                  "The parser failed");
+  Maybe<i::JsonIncrementalParser::Status> status = impl_->Parse(
+      base::TimeDelta::FromMillisecondsD(time_budget_in_ms), byte_budget);
+  if (status.IsNothing()) return Nothing<Status>();
+  switch (status.FromJust()) {
+    case i::JsonIncrementalParser::Status::kNeedsInput:
+      return Just(Status::kNeedsInput);
+    case i::JsonIncrementalParser::Status::kYielded:
+      return Just(Status::kYielded);
+    case i::JsonIncrementalParser::Status::kDone:
+      return Just(Status::kDone);
+  }
+  UNREACHABLE();
+}
+
+Local<Value> JSONIncrementalParser::GetResult() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate_);
+  return Utils::ToLocal(i::direct_handle(*impl_->result(), i_isolate));
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -6564,7 +6652,11 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      young_generation_capacity_(0),
+      young_generation_target_capacity_(0),
+      young_generation_survival_ratio_(0),
+      pending_release_size_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -10419,6 +10511,12 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = i::heap::ShouldZapGarbage();
+  heap_statistics->young_generation_capacity_ = heap->NewSpaceTargetCapacity();
+  heap_statistics->young_generation_target_capacity_ =
+      heap->AdaptiveNewSpaceCapacity().value_or(0);
+  heap_statistics->young_generation_survival_ratio_ =
+      heap->tracer()->AverageSurvivalRatio() / 100;
+  heap_statistics->pending_release_size_ = heap->PendingReleaseBytes();
 
 #if V8_ENABLE_WEBASSEMBLY
   heap_statistics->malloced_memory_ +=
@@ -10531,6 +10629,30 @@ bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
   return i_isolate->heap()->MeasureMemory(std::move(delegate), execution);
 }
 
+void Isolate::SetContextAllocationLimit(Local<Context> context,
+                                        size_t limit_in_bytes) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  auto i_context = Utils::OpenDirectHandle(*context);
+  i_isolate->heap()->EnsureContextAllocationTracker()->SetLimit(
+      direct_handle(i_context->native_context(), i_isolate), limit_in_bytes);
+}
+
+size_t Isolate::GetContextAllocatedBytes(Local<Context> context) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::ContextAllocationTracker* tracker =
+      i_isolate->heap()->context_allocation_tracker();
+  if (!tracker) return 0;
+  auto i_context = Utils::OpenDirectHandle(*context);
+  return tracker->AllocatedBytes(i_context->native_context());
+}
+
+void Isolate::SetContextAllocationLimitCallback(
+    ContextAllocationLimitCallback callback, void* data) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->EnsureContextAllocationTracker()->SetCallback(callback,
+                                                                   data);
+}
+
 std::unique_ptr<MeasureMemoryDelegate> MeasureMemoryDelegate::Default(
     Isolate* v8_isolate, Local<Context> context,
     Local<Promise::Resolver> promise_resolver, MeasureMemoryMode mode) {
@@ -10760,6 +10882,14 @@ void Isolate::SetMemorySaverMode(bool memory_saver_mode_enabled) {
   i_isolate->set_memory_saver_mode_enabled(memory_saver_mode_enabled);
 }
 
+void Isolate::SetHeapGrowingTargets(const HeapGrowingTargets& targets) {
+  Utils::ApiCheck(targets.max_gc_pause_ms >= 0,
+                  "v8::Isolate::SetHeapGrowingTargets",
+                  "Pause target must not be negative");
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetHeapGrowingTargets(targets);
+}
+
 void Isolate::ClearCachesForTesting() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->AbortConcurrentOptimization(i::BlockingBehavior::kBlock);
@@ -11530,6 +11660,10 @@ int CpuProfile::GetSamplesCount() const {
   return reinterpret_cast<const i::CpuProfile*>(this)->samples_count();
 }
 
+int CpuProfile::GetDroppedSamplesCount() const {
+  return reinterpret_cast<const i::CpuProfile*>(this)->dropped_samples_count();
+}
+
 CpuProfiler* CpuProfiler::New(Isolate* v8_isolate,
                               CpuProfilingNamingMode naming_mode,
                               CpuProfilingLoggingMode logging_mode) {
@@ -11826,10 +11960,16 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
+  Utils::ApiCheck(format == kJSON || format == kBinary,
+                  "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this), stream);
+    serializer.Serialize();
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -11884,6 +12024,15 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
       reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshot(options));
 }
 
+bool HeapProfiler::TakeHeapSnapshotToStream(
+    OutputStream* stream, const HeapSnapshotOptions& options) {
+  Utils::ApiCheck(stream->GetChunkSize() > 0,
+                  "v8::HeapProfiler::TakeHeapSnapshotToStream",
+                  "Invalid stream chunk size");
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      options, stream);
+}
+
 const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(ActivityControl* control,
                                                    ObjectNameResolver* resolver,
                                                    bool hide_internals,
@@ -11962,6 +12111,10 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
   return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile();
 }
 
+AllocationProfile* HeapProfiler::GetAllocationProfileDelta() {
+  return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfileDelta();
+}
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
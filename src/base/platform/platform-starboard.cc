@@ -485,6 +485,8 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 Stack::StackSlot Stack::GetStackStart() {
   SB_NOTIMPLEMENTED();
@@ -416,6 +416,11 @@ class V8_BASE_EXPORT OS {
 
   V8_WARN_UNUSED_RESULT static bool SealPages(void* address, size_t size);
 
+  // Hints that the given range should be backed by transparent huge pages.
+  // Returns false if the platform does not support the hint.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+
   V8_WARN_UNUSED_RESULT static bool CanReserveAddressSpace();
 
   V8_WARN_UNUSED_RESULT static std::optional<AddressSpaceReservation>
@@ -383,8 +383,59 @@ TNode<JSObject> ConstructorBuiltinsAssembler::FastNewObject(
   }
 
   BIND(&instantiate_map);
-  return AllocateJSObjectFromMap(initial_map, properties.value(), std::nullopt,
-                                 AllocationFlag::kNone, kWithSlackTracking);
+  if (!V8_ALLOCATION_SITE_TRACKING_BOOL) {
+    return AllocateJSObjectFromMap(initial_map, properties.value(),
+                                   std::nullopt, AllocationFlag::kNone,
+                                   kWithSlackTracking);
+  }
+
+  // Constructors with an allocation site in their feedback vector get a
+  // memento behind each instance, so that the site collects pretenuring
+  // feedback (see JSFunction::EnsureConstructorAllocationSite). Like literals,
+  // the instances are always allocated young here; optimized code picks up
+  // the pretenuring decision of the site. As in Runtime::kNewObject, instances
+  // of subclasses (new_target != target) don't use the site.
+  TVARIABLE(JSObject, var_obj);
+  Label without_memento(this), with_memento(this), done(this);
+  GotoIfNot(HasConstructorPretenuringFlag(), &without_memento);
+  GotoIf(TaggedNotEqual(target, new_target), &without_memento);
+  TNode<HeapObject> feedback_cell_value = LoadFeedbackCellValue(target);
+  GotoIfNot(IsFeedbackVector(feedback_cell_value), &without_memento);
+  TNode<Object> maybe_site =
+      LoadObjectField(CAST(feedback_cell_value),
+                      FeedbackVector::kConstructorAllocationSiteOffset);
+  Branch(IsUndefined(maybe_site), &without_memento, &with_memento);
+
+  BIND(&without_memento);
+  {
+    var_obj = AllocateJSObjectFromMap(initial_map, properties.value(),
+                                      std::nullopt, AllocationFlag::kNone,
+                                      kWithSlackTracking);
+    Goto(&done);
+  }
+
+  BIND(&with_memento);
+  {
+    TNode<IntPtrT> instance_size =
+        TimesTaggedSize(LoadMapInstanceSizeInWords(initial_map));
+    TNode<IntPtrT> aligned_instance_size =
+        AlignToAllocationAlignment(instance_size);
+    constexpr int kMementoSize =
+        ALIGN_TO_ALLOCATION_ALIGNMENT(sizeof(AllocationMemento));
+    TNode<HeapObject> object = AllocateInNewSpace(
+        IntPtrAdd(aligned_instance_size, IntPtrConstant(kMementoSize)));
+    StoreMapNoWriteBarrier(object, initial_map);
+    InitializeAllocationMemento(object, aligned_instance_size,
+                                CAST(maybe_site));
+    InitializeJSObjectFromMap(object, initial_map, instance_size,
+                              properties.value(), std::nullopt,
+                              kWithSlackTracking);
+    var_obj = CAST(object);
+    Goto(&done);
+  }
+
+  BIND(&done);
+  return var_obj.value();
 }
 
 TNode<Context> ConstructorBuiltinsAssembler::FastNewFunctionContext(
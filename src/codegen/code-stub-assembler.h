@@ -3007,6 +3007,11 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
         ExternalReference::address_of_shared_string_table_flag());
   }
 
+  TNode<BoolT> HasConstructorPretenuringFlag() {
+    return LoadRuntimeFlag(
+        ExternalReference::address_of_constructor_pretenuring_flag());
+  }
+
   TNode<BoolT> IsAdditiveSafeIntegerFeedbackEnabled() {
     if (Is64()) {
       return LoadRuntimeFlag(
@@ -35,6 +35,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate.h"
+#include "src/execution/tiering-manager.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
@@ -1516,6 +1517,7 @@ void FinalizeUnoptimizedCompilation(
     LogUnoptimizedCompilation(isolate, shared_info, log_tag,
                               finalize_data.time_taken_to_execute(),
                               finalize_data.time_taken_to_finalize());
+    isolate->tiering_manager()->NotifyCompiled(*shared_info);
   }
 }
 
@@ -4420,6 +4422,8 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
               compilation_info->function_context_specializing());
         }
         CompilerTracer::TraceCompletedJob(isolate, compilation_info);
+        isolate->tiering_manager()->NotifyOptimized(*shared,
+                                                    CodeKind::TURBOFAN_JS);
         if (IsOSR(osr_offset)) {
           CompilerTracer::TraceOptimizeOSRFinished(isolate, function,
                                                    osr_offset);
@@ -4502,6 +4506,7 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
     RecordMaglevFunctionCompilation(isolate, function,
                                     Cast<AbstractCode>(code));
     job->RecordCompilationStats(isolate);
+    isolate->tiering_manager()->NotifyOptimized(*shared, CodeKind::MAGLEV);
     if (v8_flags.profile_guided_optimization &&
         shared->cached_tiering_decision() <=
             CachedTieringDecision::kEarlySparkplug) {
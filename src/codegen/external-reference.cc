@@ -886,6 +886,10 @@ ExternalReference ExternalReference::address_of_builtin_subclassing_flag() {
   return ExternalReference(&v8_flags.builtin_subclassing);
 }
 
+ExternalReference ExternalReference::address_of_constructor_pretenuring_flag() {
+  return ExternalReference(&v8_flags.constructor_allocation_site_pretenuring);
+}
+
 ExternalReference ExternalReference::address_of_runtime_stats_flag() {
   return ExternalReference(&TracingFlags::runtime_stats);
 }
@@ -93,6 +93,8 @@ enum class IsolateFieldId : uint8_t;
   V(abort_with_reason, "abort_with_reason")                                    \
   V(address_of_log_or_trace_osr, "v8_flags.log_or_trace_osr")                  \
   V(address_of_builtin_subclassing_flag, "v8_flags.builtin_subclassing")       \
+  V(address_of_constructor_pretenuring_flag,                                   \
+    "v8_flags.constructor_allocation_site_pretenuring")                        \
   V(address_of_double_abs_constant, "double_absolute_constant")                \
   V(address_of_double_neg_constant, "double_negate_constant")                  \
   V(address_of_enable_experimental_regexp_engine,                              \
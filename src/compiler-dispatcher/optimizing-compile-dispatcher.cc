@@ -4,7 +4,10 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
+#include "src/base/bits.h"
 #include "src/base/fpu.h"
 #include "src/base/logging.h"
 #include "src/base/platform/mutex.h"
@@ -13,13 +16,15 @@
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate-inl.h"
+#include "src/execution/tiering-manager.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
-#include "src/objects/js-function.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
@@ -193,6 +198,7 @@ void OptimizingCompileTaskExecutor::ClearTaskState(
     OptimizingCompileTaskState& task_state) {
   base::MutexGuard guard(input_queue_.mutex_);
   DCHECK_NOT_NULL(task_state.isolate);
+  input_queue_.TaskStopped(task_state.isolate);
   task_state.isolate = nullptr;
   DCHECK_NULL(task_state.job);
   input_queue_.task_finished_.NotifyAll();
@@ -207,11 +213,11 @@ void OptimizingCompileTaskExecutor::ResetJob(
 }
 
 bool OptimizingCompileTaskExecutor::TryQueueForOptimization(
-    std::unique_ptr<TurbofanCompilationJob>& job) {
+    std::unique_ptr<TurbofanCompilationJob>& job, int priority) {
   Isolate* isolate = job->isolate();
   DCHECK_NOT_NULL(isolate);
 
-  if (input_queue_.Enqueue(job)) {
+  if (input_queue_.Enqueue(job, priority)) {
     if (job_handle_->UpdatePriorityEnabled()) {
       job_handle_->UpdatePriority(isolate->EfficiencyModeEnabled()
                                       ? kEfficiencyTaskPriority
@@ -366,7 +372,30 @@ bool OptimizingCompileDispatcher::HasJobs() {
 
 bool OptimizingCompileDispatcher::TryQueueForOptimization(
     std::unique_ptr<TurbofanCompilationJob>& job) {
-  return task_executor_->TryQueueForOptimization(job);
+  int priority = 0;
+  if (v8_flags.concurrent_recompilation_priority_queue) {
+    // Gather the signals here on the main thread, since background threads
+    // must not look at the job's handles.
+    OptimizedCompilationInfo* info = job->compilation_info();
+    if (!info->closure().is_null()) {
+      Tagged<JSFunction> function = *info->closure();
+      int invocations_per_second =
+          isolate_->tiering_manager()->InvocationsPerSecond(function);
+      int osr_urgency = 0;
+      if (function->has_feedback_vector()) {
+        osr_urgency = function->feedback_vector()->osr_urgency();
+      }
+      int bytecode_length = 0;
+      if (info->shared_info()->HasBytecodeArray()) {
+        bytecode_length =
+            info->shared_info()->GetBytecodeArray(isolate_)->length();
+      }
+      priority = OptimizingCompileInputQueue::Priority(
+          info->is_osr(), osr_urgency, invocations_per_second,
+          bytecode_length);
+    }
+  }
+  return task_executor_->TryQueueForOptimization(job, priority);
 }
 
 void OptimizingCompileDispatcher::Prioritize(
@@ -380,32 +409,36 @@ void OptimizingCompileInputQueue::Prioritize(
   // that we never dereference handles during a safepoint.
   DCHECK_EQ(isolate->thread_id(), ThreadId::Current());
   base::MutexGuard access(&mutex_);
-  auto it =
-      std::find_if(queue_.begin(), queue_.end(),
-                   [isolate, function](TurbofanCompilationJob* job) {
-                     // Early bailout to avoid dereferencing handles from other
-                     // isolates. The other isolate could be in a safepoint/GC
-                     // and dereferencing the handle is therefore invalid.
-                     if (job->isolate() != isolate) return false;
-                     return *job->compilation_info()->shared_info() == function;
-                   });
-
-  if (it != queue_.end()) {
-    auto first_for_isolate = std::find_if(
-        queue_.begin(), queue_.end(), [isolate](TurbofanCompilationJob* job) {
-          return job->isolate() == isolate;
-        });
-    DCHECK_NE(first_for_isolate, queue_.end());
-    std::iter_swap(it, first_for_isolate);
+  auto it = std::find_if(queue_.begin(), queue_.end(),
+                         [isolate, function](const Entry& entry) {
+                           // Early bailout to avoid dereferencing handles from
+                           // other isolates. The other isolate could be in a
+                           // safepoint/GC and dereferencing the handle is
+                           // therefore invalid.
+                           if (entry.job->isolate() != isolate) return false;
+                           return *entry.job->compilation_info()
+                                       ->shared_info() == function;
+                         });
+  if (it == queue_.end()) return;
+
+  if (use_priorities_) {
+    it->priority = kMaxPriority;
+    return;
   }
+  auto first_for_isolate =
+      std::find_if(queue_.begin(), queue_.end(), [isolate](const Entry& entry) {
+        return entry.job->isolate() == isolate;
+      });
+  DCHECK_NE(first_for_isolate, queue_.end());
+  std::iter_swap(it, first_for_isolate);
 }
 
 void OptimizingCompileInputQueue::FlushJobsForIsolate(Isolate* isolate) {
   base::MutexGuard access(&mutex_);
-  std::erase_if(queue_, [isolate](TurbofanCompilationJob* job) {
-    if (job->isolate() != isolate) return false;
-    Compiler::DisposeTurbofanCompilationJob(isolate, job);
-    delete job;
+  std::erase_if(queue_, [isolate](const Entry& entry) {
+    if (entry.job->isolate() != isolate) return false;
+    Compiler::DisposeTurbofanCompilationJob(isolate, entry.job);
+    delete entry.job;
     return true;
   });
 }
@@ -413,42 +446,151 @@ void OptimizingCompileInputQueue::FlushJobsForIsolate(Isolate* isolate) {
 bool OptimizingCompileInputQueue::HasJobForIsolate(Isolate* isolate) {
   mutex_.AssertHeld();
   return std::find_if(queue_.begin(), queue_.end(),
-                      [isolate](TurbofanCompilationJob* job) {
-                        return job->isolate() == isolate;
+                      [isolate](const Entry& entry) {
+                        return entry.job->isolate() == isolate;
                       }) != queue_.end();
 }
 
+// static
+int OptimizingCompileInputQueue::Priority(bool is_osr, int osr_urgency,
+                                          int invocations_per_second,
+                                          int bytecode_length) {
+  auto log2 = [](int value) {
+    return 31 - base::bits::CountLeadingZeros32(
+                    static_cast<uint32_t>(std::max(value, 0)) | 1);
+  };
+  // Each doubling of the invocation rate outweighs a doubling of the bytecode
+  // length, so that hot large functions still beat cold small ones.
+  int priority = 4 * log2(invocations_per_second) - 2 * log2(bytecode_length);
+  // A function that is stuck in a loop in the interpreter benefits most.
+  if (is_osr) priority += 64 + 4 * osr_urgency;
+  return priority;
+}
+
+std::deque<OptimizingCompileInputQueue::Entry>::iterator
+OptimizingCompileInputQueue::Next(Isolate* current_isolate) {
+  mutex_.AssertHeld();
+  DCHECK(!queue_.empty());
+  if (!use_priorities_ && !fair_scheduling_) return queue_.begin();
+  const base::TimeTicks now = now_();
+  auto effective_priority = [this, now](const Entry& entry) -> int64_t {
+    if (!use_priorities_) return 0;
+    int64_t priority = entry.priority;
+    if (aging_ms_ > 0) {
+      priority += (now - entry.enqueue_time).InMilliseconds() / aging_ms_;
+    }
+    return priority;
+  };
+  auto running_tasks = [this, current_isolate](const Entry& entry) {
+    if (!fair_scheduling_) return 0;
+    Isolate* isolate = entry.job->isolate();
+    auto it = running_tasks_.find(isolate);
+    int count = it == running_tasks_.end() ? 0 : it->second;
+    return isolate == current_isolate ? count - 1 : count;
+  };
+  // Prefer isolates with fewer running tasks, then higher priorities.
+  // max_element returns the first of equal elements, so that ties are
+  // dequeued in FIFO order.
+  return std::max_element(
+      queue_.begin(), queue_.end(), [&](const Entry& a, const Entry& b) {
+        int running_a = running_tasks(a);
+        int running_b = running_tasks(b);
+        if (running_a != running_b) return running_a > running_b;
+        return effective_priority(a) < effective_priority(b);
+      });
+}
+
+void OptimizingCompileInputQueue::TaskStopped(Isolate* isolate) {
+  mutex_.AssertHeld();
+  if (!fair_scheduling_) return;
+  auto it = running_tasks_.find(isolate);
+  DCHECK_NE(it, running_tasks_.end());
+  if (--it->second == 0) running_tasks_.erase(it);
+}
+
+TurbofanCompilationJob* OptimizingCompileInputQueue::Remove(
+    std::deque<Entry>::iterator it, base::TimeDelta* wait_time) {
+  mutex_.AssertHeld();
+  TurbofanCompilationJob* job = it->job;
+  DCHECK_NOT_NULL(job);
+  *wait_time = now_() - it->enqueue_time;
+  queue_.erase(it);
+  return job;
+}
+
+// static
+void OptimizingCompileInputQueue::RecordWaitTime(TurbofanCompilationJob* job,
+                                                 base::TimeDelta wait_time) {
+  // The task that dequeued the job keeps its isolate alive, see
+  // OptimizingCompileTaskExecutor::IsTaskRunningForIsolate().
+  job->isolate()
+      ->counters()
+      ->turbofan_optimize_queue_wait_time()
+      ->AddTimedSample(wait_time);
+}
+
 TurbofanCompilationJob* OptimizingCompileInputQueue::Dequeue(
     OptimizingCompileTaskState& task_state) {
-  base::MutexGuard access(&mutex_);
-  DCHECK_NULL(task_state.isolate);
-  if (queue_.empty()) return nullptr;
-  TurbofanCompilationJob* job = queue_.front();
-  queue_.pop_front();
-  DCHECK_NOT_NULL(job);
-  task_state.isolate = job->isolate();
-  task_state.job = job;
+  TurbofanCompilationJob* job;
+  base::TimeDelta wait_time;
+  {
+    base::MutexGuard access(&mutex_);
+    DCHECK_NULL(task_state.isolate);
+    if (queue_.empty()) return nullptr;
+    job = Remove(Next(), &wait_time);
+    task_state.isolate = job->isolate();
+    task_state.job = job;
+    if (fair_scheduling_) running_tasks_[job->isolate()]++;
+  }
+  RecordWaitTime(job, wait_time);
   return job;
 }
 
 TurbofanCompilationJob* OptimizingCompileInputQueue::DequeueIfIsolateMatches(
     OptimizingCompileTaskState& task_state) {
-  base::MutexGuard access(&mutex_);
-  if (queue_.empty()) return nullptr;
-  TurbofanCompilationJob* job = queue_.front();
-  DCHECK_NOT_NULL(job);
-  if (job->isolate() != task_state.isolate) return nullptr;
-  DCHECK_NULL(task_state.job);
-  task_state.job = job;
-  queue_.pop_front();
+  TurbofanCompilationJob* job;
+  base::TimeDelta wait_time;
+  {
+    base::MutexGuard access(&mutex_);
+    if (queue_.empty()) return nullptr;
+    auto it = Next(task_state.isolate);
+    DCHECK_NOT_NULL(it->job);
+    if (it->job->isolate() != task_state.isolate) return nullptr;
+    DCHECK_NULL(task_state.job);
+    job = Remove(it, &wait_time);
+    task_state.job = job;
+  }
+  RecordWaitTime(job, wait_time);
   return job;
 }
 
+bool OptimizingCompileInputQueue::HasRoomFor(Isolate* isolate) {
+  mutex_.AssertHeld();
+  if (queue_.size() >= capacity_) return false;
+  if (!fair_scheduling_) return true;
+  size_t own_jobs = 0;
+  size_t other_isolates = 0;
+  for (auto it = queue_.begin(); it != queue_.end(); ++it) {
+    Isolate* other = it->job->isolate();
+    if (other == isolate) {
+      own_jobs++;
+    } else if (std::none_of(queue_.begin(), it, [other](const Entry& entry) {
+                 return entry.job->isolate() == other;
+               })) {
+      other_isolates++;
+    }
+  }
+  // Split the queue between the isolates with queued jobs, this one, and one
+  // that may come next.
+  size_t quota = std::max<size_t>(1, capacity_ / (other_isolates + 2));
+  return own_jobs < quota;
+}
+
 bool OptimizingCompileInputQueue::Enqueue(
-    std::unique_ptr<TurbofanCompilationJob>& job) {
+    std::unique_ptr<TurbofanCompilationJob>& job, int priority) {
   base::MutexGuard access(&mutex_);
-  if (queue_.size() < capacity_) {
-    queue_.push_back(job.release());
+  if (HasRoomFor(job->isolate())) {
+    queue_.push_back({job.release(), priority, now_()});
     return true;
   } else {
     return false;
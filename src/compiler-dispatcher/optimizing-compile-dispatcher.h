@@ -8,8 +8,10 @@
 #include <atomic>
 #include <queue>
 
+#include "absl/container/flat_hash_map.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/base/vector.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
@@ -31,12 +33,20 @@ struct alignas(PROCESSOR_CACHE_LINE_SIZE) OptimizingCompileTaskState {
   TurbofanCompilationJob* job;
 };
 
-// Circular queue of incoming recompilation tasks (including OSR).
+// Queue of incoming recompilation tasks (including OSR). Jobs are dequeued in
+// FIFO order, or with --concurrent-recompilation-priority-queue in order of
+// their priority, which grows while a job waits so that it does not starve.
+// With --concurrent-recompilation-fair-scheduling, jobs of the isolates with
+// the fewest running tasks are dequeued first, and each isolate may only fill
+// its share of the queue.
 class V8_EXPORT OptimizingCompileInputQueue {
  public:
-  inline bool IsAvailable() {
+  // Priority of jobs that were explicitly prioritized, see Prioritize().
+  static constexpr int kMaxPriority = 1 << 20;
+
+  inline bool IsAvailable(Isolate* isolate) {
     base::MutexGuard access(&mutex_);
-    return queue_.size() < capacity_;
+    return HasRoomFor(isolate);
   }
 
   inline size_t Length() {
@@ -44,34 +54,82 @@ class V8_EXPORT OptimizingCompileInputQueue {
     return queue_.size();
   }
 
-  explicit OptimizingCompileInputQueue(int capacity) : capacity_(capacity) {}
+  explicit OptimizingCompileInputQueue(int capacity)
+      : capacity_(capacity),
+        use_priorities_(v8_flags.concurrent_recompilation_priority_queue),
+        aging_ms_(v8_flags.concurrent_recompilation_aging_ms),
+        fair_scheduling_(v8_flags.concurrent_recompilation_fair_scheduling) {}
 
   TurbofanCompilationJob* Dequeue(OptimizingCompileTaskState& task_state);
   TurbofanCompilationJob* DequeueIfIsolateMatches(
       OptimizingCompileTaskState& task_state);
 
-  bool Enqueue(std::unique_ptr<TurbofanCompilationJob>& job);
+  bool Enqueue(std::unique_ptr<TurbofanCompilationJob>& job, int priority = 0);
 
   void FlushJobsForIsolate(Isolate* isolate);
   bool HasJobForIsolate(Isolate* isolate);
 
   void Prioritize(Isolate* isolate, Tagged<SharedFunctionInfo> function);
 
+  // Computes the priority of a job: frequently invoked functions and urgent
+  // OSR requests first, and among equally hot functions the cheaper ones to
+  // compile.
+  static int Priority(bool is_osr, int osr_urgency, int invocations_per_second,
+                      int bytecode_length);
+
  private:
-  std::deque<TurbofanCompilationJob*> queue_;
+  struct Entry {
+    TurbofanCompilationJob* job;
+    int priority;
+    base::TimeTicks enqueue_time;
+  };
+
+  // Returns the entry to dequeue next. The queue must not be empty.
+  // `current_isolate` is the isolate of the task asking, if any, which does not
+  // count as a running task for the purpose of fair scheduling.
+  std::deque<Entry>::iterator Next(Isolate* current_isolate = nullptr);
+  // Removes the entry and returns its job and how long it waited, which the
+  // caller records with RecordWaitTime() once the mutex is released.
+  TurbofanCompilationJob* Remove(std::deque<Entry>::iterator it,
+                                 base::TimeDelta* wait_time);
+  static void RecordWaitTime(TurbofanCompilationJob* job,
+                             base::TimeDelta wait_time);
+
+  // Invoked when a task stops working on jobs of the given isolate.
+  void TaskStopped(Isolate* isolate);
+
+  // Whether the isolate may enqueue another job. With fair scheduling, the
+  // isolates that have queued jobs split the queue between them and one more
+  // isolate, so that an isolate with a burst of jobs cannot lock out the
+  // others.
+  bool HasRoomFor(Isolate* isolate);
+
+  std::deque<Entry> queue_;
   size_t capacity_;
 
+  // Copies of the flags, since they may change while background threads run.
+  const bool use_priorities_;
+  const int aging_ms_;
+  const bool fair_scheduling_;
+
+  // Clock for enqueue times and aging, replaced in tests.
+  base::TimeTicks (*now_)() = &base::TimeTicks::Now;
+
+  // Number of tasks working on jobs of each isolate.
+  absl::flat_hash_map<Isolate*, int> running_tasks_;
+
   base::Mutex mutex_;
   base::ConditionVariable task_finished_;
 
   friend class OptimizingCompileTaskExecutor;
+  friend class OptimizingCompileInputQueueTest;
 };
 
 // This class runs compile tasks in a thread pool. Threads grab new work from
 // the input_queue_ defined in this class. Once a task is done, it will be
-// enqueued into an isolate-local output queue. This class is
-// not specific to a particular isolate and may be shared across multiple
-// isolates in the future.
+// enqueued into an isolate-local output queue. This class is not specific to
+// a particular isolate and is shared by all isolates of an IsolateGroup, so
+// --concurrent-turbofan-max-threads bounds the compile threads of all of them.
 class V8_EXPORT OptimizingCompileTaskExecutor {
  public:
   OptimizingCompileTaskExecutor();
@@ -112,7 +170,8 @@ class V8_EXPORT OptimizingCompileTaskExecutor {
 
   // Tries to append a new compilation job to the input queue. This may fail if
   // the input queue was already full.
-  bool TryQueueForOptimization(std::unique_ptr<TurbofanCompilationJob>& job);
+  bool TryQueueForOptimization(std::unique_ptr<TurbofanCompilationJob>& job,
+                               int priority = 0);
 
   // Waits until all running and queued compilation jobs for this isolate are
   // done.
@@ -150,6 +209,7 @@ class V8_EXPORT OptimizingCompileTaskExecutor {
   bool is_initialized_ = false;
 
   friend class OptimizingCompileDispatcher;
+  friend class OptimizingCompileInputQueueTest;
 };
 
 class OptimizingCompileOutputQueue {
@@ -199,8 +259,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // last job that was finalized.
   int InstallGeneratedBuiltins(int installed_count);
 
-  // Returns true if there is space available in the input queue.
-  inline bool IsQueueAvailable() { return input_queue().IsAvailable(); }
+  // Returns true if there is space available in the input queue for this
+  // isolate.
+  inline bool IsQueueAvailable() {
+    return input_queue().IsAvailable(isolate_);
+  }
 
   static bool Enabled() { return v8_flags.concurrent_recompilation; }
 
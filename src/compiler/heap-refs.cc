@@ -1799,6 +1799,13 @@ ObjectRef FeedbackCellRef::value(JSHeapBroker* broker) const {
   return MakeRefAssumeMemoryFence(broker, object()->value(kAcquireLoad));
 }
 
+OptionalAllocationSiteRef FeedbackVectorRef::constructor_allocation_site(
+    JSHeapBroker* broker) const {
+  Tagged<Object> site = object()->constructor_allocation_site(kAcquireLoad);
+  if (!IsAllocationSite(site)) return {};
+  return TryMakeRef(broker, Cast<AllocationSite>(site));
+}
+
 bool FeedbackVectorRef::was_once_deoptimized() const {
   return object()->was_once_deoptimized();
 }
@@ -876,6 +876,11 @@ class FeedbackVectorRef : public HeapObjectRef {
 
   FeedbackCellRef GetClosureFeedbackCell(JSHeapBroker* broker, int index) const;
 
+  // The allocation site tracking the instances created by `new` with this
+  // vector's function as new.target, if any.
+  OptionalAllocationSiteRef constructor_allocation_site(
+      JSHeapBroker* broker) const;
+
   bool was_once_deoptimized() const;
 };
 
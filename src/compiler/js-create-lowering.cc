@@ -126,10 +126,23 @@ Reduction JSCreateLowering::ReduceJSCreate(Node* node) {
       dependencies()->DependOnInitialMapInstanceSizePrediction(
           original_constructor);
 
+  // Pretenure the instance if the allocation site of the
+  // {original_constructor} says that its instances survive.
+  AllocationType allocation = AllocationType::kYoung;
+  OptionalFeedbackVectorRef feedback_vector =
+      original_constructor.feedback_vector(broker());
+  if (feedback_vector.has_value()) {
+    OptionalAllocationSiteRef site =
+        feedback_vector->constructor_allocation_site(broker());
+    if (site.has_value()) {
+      allocation = dependencies()->DependOnPretenureMode(*site);
+    }
+  }
+
   // Emit code to allocate the JSObject instance for the
   // {original_constructor}.
   AllocationBuilder a(jsgraph(), broker(), effect, control);
-  a.Allocate(slack_tracking_prediction.instance_size());
+  a.Allocate(slack_tracking_prediction.instance_size(), allocation);
   a.Store(AccessBuilder::ForMap(), *initial_map);
   a.Store(AccessBuilder::ForJSObjectPropertiesOrHashKnownPointer(),
           jsgraph()->EmptyFixedArrayConstant());
@@ -20,6 +20,10 @@ namespace v8::internal::compiler::turboshaft {
 // old allocation, then we'll make it old instead. The idea being that 1) if an
 // object is stored in an old object, it makes sense for it for be considered
 // old, and 2) this reduces the size of the remembered sets.
+// Old allocations typically stem from tenured allocation sites: those of
+// literals and Array constructor calls, and with
+// --constructor-allocation-site-pretenuring those of `new` on a function, so
+// that the objects a pretenured constructor stores into its instance follow.
 // For instance, if we have:
 //
 //     a = Allocate(old)
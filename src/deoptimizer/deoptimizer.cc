@@ -17,6 +17,7 @@
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
 #include "src/execution/pointer-authentication.h"
+#include "src/execution/tiering-manager.h"
 #include "src/execution/v8threads.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
@@ -1698,6 +1699,8 @@ void Deoptimizer::DoComputeOutputFrames() {
               DeoptExitIsInsideOsrLoop(
                   isolate(), function_, bytecode_offset_in_outermost_frame_,
                   compiled_code_->osr_offset(), compiled_code_->kind())))) {
+    isolate()->tiering_manager()->NotifyDeoptimized(function_->shared(),
+                                                    compiled_code_->kind());
     if (v8_flags.profile_guided_optimization &&
         function_->shared()->cached_tiering_decision() !=
             CachedTieringDecision::kDelayMaglev) {
@@ -1819,6 +1819,8 @@ void FeedbackVector::FeedbackVectorPrint(std::ostream& os) {
 #endif  // !V8_ENABLE_LEAPTIERING
   os << "\n - osr_tiering_in_progress: " << osr_tiering_in_progress();
   os << "\n - invocation count: " << invocation_count();
+  os << "\n - constructor allocation site: "
+     << Brief(constructor_allocation_site(kAcquireLoad));
   os << "\n - closure feedback cell array: ";
   closure_feedback_cell_array()->ClosureFeedbackCellArrayPrint(os);
 
@@ -66,6 +66,7 @@
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/context-allocation-tracker.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-verifier.h"
 #include "src/heap/local-heap-inl.h"
@@ -7692,6 +7693,10 @@ void Isolate::RemoveContextIdCallback(const v8::WeakCallbackInfo<void>& data) {
   Isolate* isolate = reinterpret_cast<Isolate*>(data.GetIsolate());
   uintptr_t context_id = reinterpret_cast<uintptr_t>(data.GetParameter());
   isolate->recorder_context_id_map_.erase(context_id);
+  if (ContextAllocationTracker* tracker =
+          isolate->heap()->context_allocation_tracker()) {
+    tracker->RemoveContext(context_id);
+  }
 }
 
 LocalHeap* Isolate::main_thread_local_heap() {
@@ -4,6 +4,7 @@
 
 #include "src/execution/tiering-manager.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "src/base/platform/platform.h"
@@ -22,6 +23,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/code.h"
+#include "src/objects/script-inl.h"
 #include "src/tracing/trace-event.h"
 
 #ifdef V8_ENABLE_SPARKPLUG
@@ -144,9 +146,58 @@ void TieringManager::Optimize(Tagged<JSFunction> function,
                               OptimizationDecision d) {
   DCHECK(d.should_optimize());
   TraceRecompile(isolate_, function, d);
+  if (V8_UNLIKELY(v8_flags.concurrent_recompilation_priority_queue) &&
+      d.code_kind == CodeKind::MAGLEV) {
+    RecordMaglevRequest(function);
+  }
   function->RequestOptimization(isolate_, d.code_kind, d.concurrency_mode);
 }
 
+namespace {
+
+std::pair<int, int> MaglevRequestKey(Tagged<SharedFunctionInfo> shared) {
+  int script_id =
+      IsScript(shared->script()) ? Cast<Script>(shared->script())->id() : 0;
+  return {script_id, shared->StartPosition()};
+}
+
+}  // namespace
+
+void TieringManager::RecordMaglevRequest(Tagged<JSFunction> function) {
+  if (maglev_requests_.size() >= kMaxMaglevRequests) maglev_requests_.clear();
+  maglev_requests_[MaglevRequestKey(function->shared())] = {
+      base::TimeTicks::Now(),
+      function->feedback_vector()->invocation_count(kRelaxedLoad)};
+}
+
+int TieringManager::InvocationsPerSecond(Tagged<JSFunction> function) {
+  if (!function->has_feedback_vector()) return 0;
+  int invocation_count =
+      function->feedback_vector()->invocation_count(kRelaxedLoad);
+  // The cumulative invocation count favors functions that have been around
+  // for long over those that just became hot, so divide it by the time it
+  // took to accumulate.
+  double elapsed_ms;
+  auto it = maglev_requests_.find(MaglevRequestKey(function->shared()));
+  if (it != maglev_requests_.end()) {
+    invocation_count -= it->second.invocation_count;
+    elapsed_ms = (base::TimeTicks::Now() - it->second.time).InMillisecondsF();
+    maglev_requests_.erase(it);
+  } else {
+    elapsed_ms = isolate_->time_millis_since_init();
+  }
+  double rate = std::max(invocation_count, 0) * 1000.0 /
+                std::max(elapsed_ms, 1.0);
+  return static_cast<int>(std::min(rate, static_cast<double>(kMaxInt)));
+}
+
+TieringManager::TieringManager(Isolate* isolate) : isolate_(isolate) {
+  if (V8_UNLIKELY(v8_flags.tiering_profile_record ||
+                  v8_flags.tiering_profile)) {
+    profile_ = std::make_unique<TieringProfile>();
+  }
+}
+
 void TieringManager::MarkForTurboFanOptimization(Tagged<JSFunction> function) {
   Optimize(function, OptimizationDecision::TurbofanHotAndStable());
 }
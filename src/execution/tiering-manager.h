@@ -5,9 +5,14 @@
 #ifndef V8_EXECUTION_TIERING_MANAGER_H_
 #define V8_EXECUTION_TIERING_MANAGER_H_
 
+#include <memory>
 #include <optional>
+#include <utility>
 
+#include "absl/container/flat_hash_map.h"
+#include "src/base/platform/time.h"
 #include "src/common/assert-scope.h"
+#include "src/execution/tiering-profile.h"
 #include "src/handles/handles.h"
 #include "src/utils/allocation.h"
 
@@ -18,6 +23,7 @@ class BytecodeArray;
 class Isolate;
 class JSFunction;
 class OptimizationDecision;
+class SharedFunctionInfo;
 enum class CodeKind : uint8_t;
 enum class OptimizationReason : uint8_t;
 
@@ -26,7 +32,7 @@ void TraceManualRecompile(Tagged<JSFunction> function, CodeKind code_kind,
 
 class TieringManager {
  public:
-  explicit TieringManager(Isolate* isolate) : isolate_(isolate) {}
+  explicit TieringManager(Isolate* isolate);
 
   void OnInterruptTick(DirectHandle<JSFunction> function, CodeKind code_kind);
 
@@ -42,6 +48,23 @@ class TieringManager {
 
   void MarkForTurboFanOptimization(Tagged<JSFunction> function);
 
+  // Hooks for --tiering-profile-record and --tiering-profile.
+  void NotifyOptimized(Tagged<SharedFunctionInfo> shared, CodeKind code_kind) {
+    if (V8_UNLIKELY(profile_)) profile_->RecordOptimized(shared, code_kind);
+  }
+  void NotifyDeoptimized(Tagged<SharedFunctionInfo> shared,
+                         CodeKind code_kind) {
+    if (V8_UNLIKELY(profile_)) profile_->RecordDeoptimized(shared, code_kind);
+  }
+  void NotifyCompiled(Tagged<SharedFunctionInfo> shared) {
+    if (V8_UNLIKELY(profile_)) profile_->Apply(shared);
+  }
+
+  // Returns how often the function was invoked per second since it was marked
+  // for Maglev, or since the isolate started if it was not. Ranks its Turbofan
+  // job with --concurrent-recompilation-priority-queue.
+  int InvocationsPerSecond(Tagged<JSFunction> function);
+
  private:
   // Make the decision whether to optimize the given function, and mark it for
   // optimization if the decision was 'yes'.
@@ -64,7 +87,23 @@ class TieringManager {
     DisallowGarbageCollection no_gc;
   };
 
+  // Remembers the invocation count of a function that is marked for Maglev,
+  // for InvocationsPerSecond().
+  void RecordMaglevRequest(Tagged<JSFunction> function);
+
+  struct InvocationSample {
+    base::TimeTicks time;
+    int invocation_count;
+  };
+
+  // Functions that reach Maglev but never Turbofan leave their sample behind,
+  // so the samples are dropped once there are this many.
+  static constexpr size_t kMaxMaglevRequests = 4096;
+
   Isolate* const isolate_;
+  std::unique_ptr<TieringProfile> profile_;
+  // Keyed by script id and start position, which do not move in GCs.
+  absl::flat_hash_map<std::pair<int, int>, InvocationSample> maglev_requests_;
 };
 
 }  // namespace internal
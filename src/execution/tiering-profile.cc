@@ -0,0 +1,216 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <optional>
+#include <sstream>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
+#include "src/objects/code-kind.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// All isolates of the process append to the same recording.
+base::LazyMutex recording_file_mutex = LAZY_MUTEX_INITIALIZER;
+
+std::optional<TieringProfile::FunctionKey> KeyFor(
+    Tagged<SharedFunctionInfo> shared) {
+  if (!IsScript(shared->script())) return {};
+  Tagged<Object> name = Cast<Script>(shared->script())->name();
+  if (!IsString(name) || Cast<String>(name)->length() == 0) return {};
+  return TieringProfile::FunctionKey(Cast<String>(name)->ToCString().get(),
+                                     shared->StartPosition(),
+                                     shared->EndPosition());
+}
+
+void Accumulate(TieringProfile::TierRecord& to,
+                const TieringProfile::TierRecord& from) {
+  to.compiles += from.compiles;
+  to.deopts += from.deopts;
+  to.time_in_tier_ms += from.time_in_tier_ms;
+}
+
+}  // namespace
+
+TieringProfile::TieringProfile() {
+  if (!v8_flags.tiering_profile) return;
+  bool exists = false;
+  std::string recording =
+      ReadFile(v8_flags.tiering_profile.value(), &exists, false);
+  if (!exists) return;
+  for (const auto& [key, record] : Parse(recording)) {
+    CachedTieringDecision decision = DecisionFor(record);
+    if (decision != CachedTieringDecision::kPending) {
+      decisions_[key] = decision;
+    }
+  }
+}
+
+TieringProfile::~TieringProfile() {
+  if (v8_flags.tiering_profile_record) WriteRecording();
+}
+
+TieringProfile::RecordingState* TieringProfile::StateFor(
+    Tagged<SharedFunctionInfo> shared) {
+  if (!v8_flags.tiering_profile_record) return nullptr;
+  std::optional<FunctionKey> key = KeyFor(shared);
+  if (!key.has_value()) return nullptr;
+  return &recording_[key.value()];
+}
+
+void TieringProfile::RecordOptimized(Tagged<SharedFunctionInfo> shared,
+                                     CodeKind code_kind) {
+  RecordingState* state = StateFor(shared);
+  if (state == nullptr) return;
+  if (code_kind == CodeKind::MAGLEV) {
+    state->record.maglev.compiles++;
+    if (state->maglev_installed.IsNull()) {
+      state->maglev_installed = base::TimeTicks::Now();
+    }
+  } else if (code_kind == CodeKind::TURBOFAN_JS) {
+    state->record.turbofan.compiles++;
+    if (state->turbofan_installed.IsNull()) {
+      state->turbofan_installed = base::TimeTicks::Now();
+    }
+  }
+}
+
+void TieringProfile::RecordDeoptimized(Tagged<SharedFunctionInfo> shared,
+                                       CodeKind code_kind) {
+  RecordingState* state = StateFor(shared);
+  if (state == nullptr) return;
+  TierRecord* tier;
+  base::TimeTicks* installed;
+  if (code_kind == CodeKind::MAGLEV) {
+    tier = &state->record.maglev;
+    installed = &state->maglev_installed;
+  } else if (code_kind == CodeKind::TURBOFAN_JS) {
+    tier = &state->record.turbofan;
+    installed = &state->turbofan_installed;
+  } else {
+    return;
+  }
+  tier->deopts++;
+  if (!installed->IsNull()) {
+    tier->time_in_tier_ms +=
+        (base::TimeTicks::Now() - *installed).InMillisecondsF();
+    *installed = base::TimeTicks();
+  }
+}
+
+void TieringProfile::Apply(Tagged<SharedFunctionInfo> shared) {
+  if (decisions_.empty() || !v8_flags.profile_guided_optimization) return;
+  // Don't override what this isolate has learned already.
+  if (shared->cached_tiering_decision() >
+      CachedTieringDecision::kEarlySparkplug) {
+    return;
+  }
+  std::optional<FunctionKey> key = KeyFor(shared);
+  if (!key.has_value()) return;
+  auto it = decisions_.find(key.value());
+  if (it == decisions_.end()) return;
+  shared->set_cached_tiering_decision(it->second);
+}
+
+// static
+CachedTieringDecision TieringProfile::DecisionFor(const Record& record) {
+  if (record.turbofan.PaidOff()) return CachedTieringDecision::kEarlyTurbofan;
+  if (record.maglev.PaidOff()) return CachedTieringDecision::kEarlyMaglev;
+  if (record.maglev.compiles > 0 || record.turbofan.compiles > 0) {
+    return CachedTieringDecision::kDelayMaglev;
+  }
+  return CachedTieringDecision::kPending;
+}
+
+void TieringProfile::WriteRecording() {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  absl::flat_hash_map<FunctionKey, Record> records;
+  for (auto& [key, state] : recording_) {
+    Record& record = records[key];
+    record = state.record;
+    if (!state.maglev_installed.IsNull()) {
+      record.maglev.time_in_tier_ms +=
+          (now - state.maglev_installed).InMillisecondsF();
+    }
+    if (!state.turbofan_installed.IsNull()) {
+      record.turbofan.time_in_tier_ms +=
+          (now - state.turbofan_installed).InMillisecondsF();
+    }
+  }
+  if (records.empty()) return;
+
+  std::string recording = Serialize(records);
+  base::MutexGuard guard(recording_file_mutex.Pointer());
+  FILE* file =
+      base::OS::FOpen(v8_flags.tiering_profile_record.value(), "a");
+  if (file == nullptr) {
+    base::OS::PrintError("Failed to open tiering profile %s\n",
+                         v8_flags.tiering_profile_record.value());
+    return;
+  }
+  fwrite(recording.data(), 1, recording.size(), file);
+  base::Fclose(file);
+}
+
+// static
+std::string TieringProfile::Serialize(
+    const absl::flat_hash_map<FunctionKey, Record>& records) {
+  std::ostringstream out;
+  out.precision(3);
+  out << std::fixed;
+  for (const auto& [key, record] : records) {
+    const auto& [script_name, start_position, end_position] = key;
+    out << start_position << " " << end_position << " "
+        << record.maglev.compiles << " " << record.maglev.deopts << " "
+        << record.maglev.time_in_tier_ms << " " << record.turbofan.compiles
+        << " " << record.turbofan.deopts << " "
+        << record.turbofan.time_in_tier_ms << " " << script_name << "\n";
+  }
+  return out.str();
+}
+
+// static
+absl::flat_hash_map<TieringProfile::FunctionKey, TieringProfile::Record>
+TieringProfile::Parse(const std::string& recording) {
+  absl::flat_hash_map<FunctionKey, Record> records;
+  std::istringstream in(recording);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    int start_position;
+    int end_position;
+    Record record;
+    std::string script_name;
+    if (!(fields >> start_position >> end_position >> record.maglev.compiles >>
+          record.maglev.deopts >> record.maglev.time_in_tier_ms >>
+          record.turbofan.compiles >> record.turbofan.deopts >>
+          record.turbofan.time_in_tier_ms)) {
+      continue;
+    }
+    // The script name is the rest of the line and may contain spaces.
+    fields >> std::ws;
+    std::getline(fields, script_name);
+    if (script_name.empty()) continue;
+    Record& merged =
+        records[FunctionKey(script_name, start_position, end_position)];
+    Accumulate(merged.maglev, record.maglev);
+    Accumulate(merged.turbofan, record.turbofan);
+  }
+  return records;
+}
+
+}  // namespace internal
+}  // namespace v8
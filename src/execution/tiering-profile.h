@@ -0,0 +1,91 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_TIERING_PROFILE_H_
+#define V8_EXECUTION_TIERING_PROFILE_H_
+
+#include <string>
+#include <tuple>
+
+#include "absl/container/flat_hash_map.h"
+#include "src/base/platform/time.h"
+#include "src/common/globals.h"
+#include "src/objects/tagged.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+enum class CodeKind : uint8_t;
+
+// Records which optimizing tiers the functions of named scripts reached and
+// whether that paid off (--tiering-profile-record), or replays such a recording
+// (--tiering-profile). Functions are identified by script name and source
+// range, so that a recording can be used by later processes.
+//
+// A tier paid off for a function if its code was not thrown away by a deopt
+// every time it was installed. On replay, each function's
+// CachedTieringDecision is seeded when the function is compiled, so that the
+// existing profile-guided tiering tiers it up early to the highest tier that
+// paid off and skips the tiers below it, or delays it if no tier paid off.
+class V8_EXPORT_PRIVATE TieringProfile final {
+ public:
+  struct TierRecord {
+    uint32_t compiles = 0;
+    uint32_t deopts = 0;
+    double time_in_tier_ms = 0;
+
+    bool PaidOff() const { return compiles > deopts; }
+  };
+
+  struct Record {
+    TierRecord maglev;
+    TierRecord turbofan;
+  };
+
+  // Script name, start position and end position.
+  using FunctionKey = std::tuple<std::string, int, int>;
+
+  TieringProfile();
+  ~TieringProfile();
+  TieringProfile(const TieringProfile&) = delete;
+  TieringProfile& operator=(const TieringProfile&) = delete;
+
+  void RecordOptimized(Tagged<SharedFunctionInfo> shared, CodeKind code_kind);
+  void RecordDeoptimized(Tagged<SharedFunctionInfo> shared, CodeKind code_kind);
+
+  // Seeds the tiering decision of a newly compiled function.
+  void Apply(Tagged<SharedFunctionInfo> shared);
+
+  static CachedTieringDecision DecisionFor(const Record& record);
+
+  // The recording is a sequence of lines, one per function:
+  //   <start> <end> <maglev compiles> <maglev deopts> <maglev ms>
+  //   <turbofan compiles> <turbofan deopts> <turbofan ms> <script name>
+  // Lines for the same function, e.g. from several isolates or runs, are
+  // summed up. Malformed lines are ignored.
+  static std::string Serialize(
+      const absl::flat_hash_map<FunctionKey, Record>& records);
+  static absl::flat_hash_map<FunctionKey, Record> Parse(
+      const std::string& recording);
+
+ private:
+  struct RecordingState {
+    Record record;
+    // When the currently installed code of each tier was installed, or null.
+    base::TimeTicks maglev_installed;
+    base::TimeTicks turbofan_installed;
+  };
+
+  RecordingState* StateFor(Tagged<SharedFunctionInfo> shared);
+  void WriteRecording();
+
+  absl::flat_hash_map<FunctionKey, RecordingState> recording_;
+  absl::flat_hash_map<FunctionKey, CachedTieringDecision> decisions_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_TIERING_PROFILE_H_
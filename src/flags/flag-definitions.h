@@ -782,6 +782,9 @@ DEFINE_BOOL(empty_context_extension_dep, true,
             "non-empty context extensions")
 
 DEFINE_BOOL(json_stringify_fast_path, true, "Enable JSON.stringify fast-path")
+DEFINE_BOOL(json_parse_shape_cache, false,
+            "Predict the final map of JSON.parse objects from their first "
+            "property key")
 
 // TODO(jgruber): Remove this flag.
 DEFINE_BOOL(cache_property_key_string_adds, true,
@@ -957,6 +960,11 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(constructor_allocation_site_pretenuring, false,
+            "track an allocation site per constructor feedback vector and "
+            "pretenure instances created by `new` when they survive")
+DEFINE_NEG_NEG_IMPLICATION(allocation_site_pretenuring,
+                           constructor_allocation_site_pretenuring)
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation "
@@ -1207,6 +1215,9 @@ DEFINE_IMPLICATION(always_use_string_forwarding_table, experimental)
 // (enabled by --shared-string-table) are not supported using a single shared
 // forwarding table.
 DEFINE_NEG_IMPLICATION(shared_string_table, always_use_string_forwarding_table)
+DEFINE_BOOL(concurrent_string_table_insertion, false,
+            "insert strings into the string table without holding its write "
+            "lock unless the table needs to be resized")
 
 DEFINE_BOOL(transition_strings_during_gc_with_stack, false,
             "Transition strings during a full GC with stack")
@@ -1229,6 +1240,18 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_BOOL(concurrent_recompilation_priority_queue, false,
+            "dequeue concurrent recompilation jobs by priority (hotness, OSR "
+            "urgency and estimated compile cost) instead of in FIFO order")
+DEFINE_INT(concurrent_recompilation_aging_ms, 10,
+           "milliseconds that a queued recompilation job waits to gain one "
+           "priority level, so that low priority jobs do not starve "
+           "(0: no aging)")
+DEFINE_BOOL(concurrent_recompilation_fair_scheduling, false,
+            "dequeue concurrent recompilation jobs of the isolates that have "
+            "the fewest jobs running first, and limit each isolate to its "
+            "share of the input queue, so that isolates sharing the compile "
+            "threads get a fair share of them")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(concurrent_recompilation_front_running, true,
@@ -1734,6 +1757,18 @@ DEFINE_INT(invocation_count_for_maglev_with_delay, 600,
            "invocation count for maglev for functions which according to "
            "profile_guided_optimization are likely to deoptimize before "
            "reaching this invocation count")
+DEFINE_BOOL(code_cache_tiering_decisions, false,
+            "keep the decision to delay Maglev for functions that "
+            "deoptimized early in the code cache, instead of resetting it to "
+            "early Sparkplug")
+DEFINE_NEG_NEG_IMPLICATION(profile_guided_optimization,
+                           code_cache_tiering_decisions)
+DEFINE_STRING(tiering_profile_record, nullptr,
+              "append the tiers that the functions of named scripts reached, "
+              "and how often they deoptimized there, to the given file")
+DEFINE_STRING(tiering_profile, nullptr,
+              "seed the tiering decisions of functions from a file written by "
+              "--tiering-profile-record, skipping tiers that never paid off")
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, false,
@@ -2218,6 +2253,15 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
 // Set minimum semi space growth factor
 DEFINE_MIN_VALUE_IMPLICATION(semi_space_growth_factor, 2)
+DEFINE_BOOL(adaptive_new_space_sizing, false,
+            "resize new space after young generation collections to reach a "
+            "target collection interval, shortened for high survival ratios")
+DEFINE_UINT(new_space_target_collection_interval_ms, 100,
+            "target time between young generation collections (in ms) for "
+            "--adaptive-new-space-sizing")
+DEFINE_UINT(new_space_target_survival_percent, 10,
+            "survival ratio (in percent) above which "
+            "--adaptive-new-space-sizing shortens the collection interval")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -2329,6 +2373,12 @@ DEFINE_INT(
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(background_array_buffer_release, false,
+            "deallocate large array buffer backing stores that die or are "
+            "detached on the main thread on a background thread")
+DEFINE_SIZE_T(background_array_buffer_release_min_size, 64 * KB,
+              "minimum backing store size in bytes for "
+              "--background-array-buffer-release")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
@@ -2339,6 +2389,13 @@ DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping,
                            concurrent_array_buffer_sweeping)
+DEFINE_BOOL(concurrent_large_page_release, false,
+            "release dead large object pages on concurrent sweeper threads")
+DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping, concurrent_large_page_release)
+DEFINE_SIZE_T(max_pending_large_page_release, 256,
+              "maximum size in MB of dead large object pages waiting to be "
+              "released by the sweeper before they are released on the main "
+              "thread")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
@@ -2423,6 +2480,15 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_INT(memory_reducer_gc_count, 2,
            "Maximum number of memory reducer GCs scheduled")
+DEFINE_BOOL(group_memory_reducer, false,
+            "coordinate the memory reducers of all isolates in an isolate "
+            "group, releasing pooled pages of idle isolates and reducing "
+            "idle isolates when the group exceeds its budget")
+DEFINE_NEG_NEG_IMPLICATION(memory_reducer, group_memory_reducer)
+DEFINE_SIZE_T(group_memory_reducer_budget, 0,
+              "committed heap memory (in MB) of all isolates in an isolate "
+              "group above which idle isolates are asked to reduce their "
+              "memory (0: no budget)")
 DEFINE_BOOL(
     external_memory_accounted_in_global_limit, false,
     "External memory limits are computed as part of global limits in v8 Heap.")
@@ -2442,6 +2508,13 @@ DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
 DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
+DEFINE_FLOAT(compaction_pause_target_ms, 0,
+             "bound the bytes evacuated by a full GC such that compaction is "
+             "expected to take at most this many milliseconds of the atomic "
+             "pause; remaining fragmented pages are compacted by later GCs. "
+             "Unlike a target derived from the embedder's pause target, this "
+             "may also allow more than the default 4MB to be evacuated "
+             "(0 means no target)")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_BOOL(shortcut_strings_with_stack, true,
@@ -2494,6 +2567,10 @@ DEFINE_SIZE_T(max_large_page_pool_size, 32,
               "Maximum size of pooled large pages in MB.")
 DEFINE_INT(large_page_pool_timeout, 3,
            "Release pooled large pages after X seconds.")
+DEFINE_BOOL(huge_page_regions, false,
+            "pack old and trusted space pages into 2MB-aligned regions backed "
+            "by transparent huge pages and advise the code range to use huge "
+            "pages (Linux only)")
 DEFINE_BOOL(managed_zone_memory, false,
             "Manage zone memory in V8 instead of using malloc().")
 DEFINE_NEG_NEG_IMPLICATION(memory_pool, managed_zone_memory)
@@ -2811,6 +2888,9 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_SIZE_T(cpu_profiler_tick_buffer_size, 512 * KB,
+              "size in bytes of the buffer holding CPU profiler ticks until "
+              "they are processed; ticks are dropped when it is full")
 
 // debugger
 DEFINE_BOOL(
@@ -3727,6 +3807,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_ref_clearing)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, background_array_buffer_release)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, cppheap_concurrent_marking)
 
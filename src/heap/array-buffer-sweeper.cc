@@ -5,8 +5,10 @@
 #include "src/heap/array-buffer-sweeper.h"
 
 #include <atomic>
+#include <iterator>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "src/base/logging.h"
 #include "src/execution/isolate-inl.h"
@@ -15,6 +17,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/js-array-buffer.h"
 
 namespace v8 {
@@ -86,6 +89,111 @@ bool ArrayBufferList::IsEmpty() const {
   return head_ == nullptr;
 }
 
+// Deallocates backing stores of array buffers that became unreachable or were
+// detached on the main thread on a background job, so that the main thread does
+// not pay for free() or munmap() of large buffers.
+class ArrayBufferSweeper::BackingStoreReleaser final {
+ public:
+  using Batch = std::vector<std::shared_ptr<BackingStore>>;
+
+  BackingStoreReleaser() = default;
+  ~BackingStoreReleaser() { DCHECK(!job_handle_ || !job_handle_->IsValid()); }
+
+  // Returns true if dropping `backing_store` would deallocate a buffer that is
+  // large enough to be worth deferring.
+  static bool ShouldDefer(const std::shared_ptr<BackingStore>& backing_store) {
+    return backing_store && backing_store.use_count() == 1 &&
+           backing_store->byte_capacity() >=
+               v8_flags.background_array_buffer_release_min_size;
+  }
+
+  void Release(Batch batch);
+  // Waits until all pending backing stores are deallocated. The calling thread
+  // contributes.
+  void Finish();
+
+  size_t pending_bytes() const {
+    return pending_bytes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  class ReleaseJob;
+
+  base::Mutex mutex_;
+  Batch pending_;
+  // Both counters are incremented under `mutex_` before the backing stores
+  // become visible to the job.
+  std::atomic<size_t> pending_bytes_{0};
+  std::atomic<size_t> pending_count_{0};
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
+class ArrayBufferSweeper::BackingStoreReleaser::ReleaseJob final
+    : public JobTask {
+ public:
+  explicit ReleaseJob(BackingStoreReleaser& releaser) : releaser_(releaser) {}
+
+  ~ReleaseJob() override = default;
+
+  ReleaseJob(const ReleaseJob&) = delete;
+  ReleaseJob& operator=(const ReleaseJob&) = delete;
+
+  void Run(JobDelegate* delegate) final {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                 "V8.GC_BACKGROUND_ARRAY_BUFFER_RELEASE");
+    while (!delegate->ShouldYield()) {
+      std::shared_ptr<BackingStore> backing_store;
+      {
+        base::MutexGuard guard(&releaser_.mutex_);
+        if (releaser_.pending_.empty()) return;
+        backing_store = std::move(releaser_.pending_.back());
+        releaser_.pending_.pop_back();
+      }
+      const size_t bytes = backing_store->byte_capacity();
+      backing_store.reset();
+      releaser_.pending_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+      releaser_.pending_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    // Deallocations mostly serialize on the process' address space lock, so a
+    // single worker suffices.
+    return releaser_.pending_count_.load(std::memory_order_relaxed) > 0 ? 1
+                                                                        : 0;
+  }
+
+ private:
+  BackingStoreReleaser& releaser_;
+};
+
+void ArrayBufferSweeper::BackingStoreReleaser::Release(Batch batch) {
+  if (batch.empty()) return;
+  size_t bytes = 0;
+  for (const auto& backing_store : batch) {
+    bytes += backing_store->byte_capacity();
+  }
+  {
+    base::MutexGuard guard(&mutex_);
+    pending_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    pending_count_.fetch_add(batch.size(), std::memory_order_relaxed);
+    pending_.insert(pending_.end(), std::make_move_iterator(batch.begin()),
+                    std::make_move_iterator(batch.end()));
+  }
+  if (job_handle_ && job_handle_->IsValid()) {
+    job_handle_->NotifyConcurrencyIncrease();
+  } else {
+    job_handle_ = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserVisible, std::make_unique<ReleaseJob>(*this));
+  }
+}
+
+void ArrayBufferSweeper::BackingStoreReleaser::Finish() {
+  if (job_handle_ && job_handle_->IsValid()) job_handle_->Join();
+  DCHECK(pending_.empty());
+  DCHECK_EQ(0, pending_bytes());
+}
+
 class ArrayBufferSweeper::SweepingState final {
   enum class Status { kInProgress, kDone };
 
@@ -183,6 +291,10 @@ class ArrayBufferSweeper::SweepingState::SweepingJob final : public JobTask {
   bool SweepFull(JobDelegate* delegate);
   bool SweepListFull(JobDelegate* delegate, ArrayBufferList& list,
                      ArrayBufferExtension::Age age);
+  // Returns `batch` if unreachable backing stores should be collected for the
+  // background releaser on the current thread, and nullptr otherwise.
+  BackingStoreReleaser::Batch* ReleaseBatchForThread(
+      JobDelegate* delegate, BackingStoreReleaser::Batch& batch) const;
 
   Heap* const heap_;
   SweepingState& state_;
@@ -248,10 +360,14 @@ ArrayBufferSweeper::SweepingState::SweepingState(
               heap, *this, std::move(young), std::move(old), type,
               treat_all_young_as_promoted, trace_id))) {}
 
-ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap) : heap_(heap) {}
+ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap)
+    : heap_(heap), releaser_(std::make_unique<BackingStoreReleaser>()) {}
 
 ArrayBufferSweeper::~ArrayBufferSweeper() {
   EnsureFinished();
+  // The embedder's array buffer allocator may not outlive the isolate, so all
+  // deferred deallocations need to happen before returning.
+  releaser_->Finish();
   ReleaseAll(&old_);
   ReleaseAll(&young_);
 }
@@ -398,6 +514,29 @@ void ArrayBufferSweeper::Detach(ArrayBufferExtension* extension) {
   DecrementExternalMemoryCounters(previous_value.accounting_length());
 }
 
+void ArrayBufferSweeper::ReleaseBackingStore(
+    std::shared_ptr<BackingStore> backing_store) {
+  if (!ShouldReleaseInBackground() ||
+      !BackingStoreReleaser::ShouldDefer(backing_store)) {
+    return;
+  }
+  BackingStoreReleaser::Batch batch;
+  batch.push_back(std::move(backing_store));
+  releaser_->Release(std::move(batch));
+}
+
+size_t ArrayBufferSweeper::PendingReleaseBytes() const {
+  return releaser_->pending_bytes();
+}
+
+bool ArrayBufferSweeper::ShouldReleaseInBackground() const {
+  // Memory-reducing GCs and memory pressure want the memory back before the
+  // GC finishes.
+  return v8_flags.background_array_buffer_release && !heap_->IsTearingDown() &&
+         !heap_->ShouldReduceMemory() && !heap_->HighMemoryPressure() &&
+         heap_->ShouldUseBackgroundThreads();
+}
+
 void ArrayBufferSweeper::UpdateApproximateBytes(int64_t delta,
                                                 ArrayBufferExtension::Age age) {
   switch (age) {
@@ -435,10 +574,19 @@ void ArrayBufferSweeper::DecrementExternalMemoryCounters(size_t bytes) {
       reinterpret_cast<v8::Isolate*>(heap_->isolate()), bytes);
 }
 
-void ArrayBufferSweeper::FinalizeAndDelete(ArrayBufferExtension* extension) {
+void ArrayBufferSweeper::FinalizeAndDelete(
+    ArrayBufferExtension* extension,
+    std::vector<std::shared_ptr<BackingStore>>* batch) {
 #ifdef V8_COMPRESS_POINTERS
   extension->ZapExternalPointerTableEntry();
 #endif  // V8_COMPRESS_POINTERS
+  if (batch) {
+    std::shared_ptr<BackingStore> backing_store =
+        extension->RemoveBackingStore();
+    if (BackingStoreReleaser::ShouldDefer(backing_store)) {
+      batch->push_back(std::move(backing_store));
+    }
+  }
   delete extension;
 }
 
@@ -461,6 +609,18 @@ void ArrayBufferSweeper::SweepingState::SweepingJob::Sweep(
   }
 }
 
+ArrayBufferSweeper::BackingStoreReleaser::Batch*
+ArrayBufferSweeper::SweepingState::SweepingJob::ReleaseBatchForThread(
+    JobDelegate* delegate, BackingStoreReleaser::Batch& batch) const {
+  // Background threads can deallocate right away. Only the main thread hands
+  // large backing stores over to the releaser.
+  if (!delegate->IsJoiningThread()) return nullptr;
+  if (!heap_->array_buffer_sweeper()->ShouldReleaseInBackground()) {
+    return nullptr;
+  }
+  return &batch;
+}
+
 bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepFull(
     JobDelegate* delegate) {
   DCHECK_EQ(SweepingType::kFull, type_);
@@ -482,6 +642,9 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepListFull(
   size_t freed_bytes = 0;
   size_t accounted_bytes = 0;
   size_t swept_extensions = 0;
+  BackingStoreReleaser::Batch release_batch;
+  BackingStoreReleaser::Batch* const batch =
+      ReleaseBatchForThread(delegate, release_batch);
 
   while (current) {
     DCHECK_EQ(list.age_, current->age());
@@ -492,7 +655,7 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepListFull(
 
     if (!current->IsMarked()) {
       freed_bytes += current->accounting_length();
-      FinalizeAndDelete(current);
+      FinalizeAndDelete(current, batch);
     } else {
       current->Unmark();
       accounted_bytes += new_old.Append(current);
@@ -501,6 +664,7 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepListFull(
     current = next;
   }
 
+  heap_->array_buffer_sweeper()->releaser_->Release(std::move(release_batch));
   state_.freed_bytes_ += freed_bytes;
   if (age == ArrayBufferExtension::Age::kYoung) {
     state_.young_bytes_accounted_ += (freed_bytes + accounted_bytes);
@@ -526,6 +690,9 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepYoung(
   size_t freed_bytes = 0;
   size_t accounted_bytes = 0;
   size_t swept_extensions = 0;
+  BackingStoreReleaser::Batch release_batch;
+  BackingStoreReleaser::Batch* const batch =
+      ReleaseBatchForThread(delegate, release_batch);
 
   while (current) {
     DCHECK_EQ(ArrayBufferExtension::Age::kYoung, current->age());
@@ -536,7 +703,7 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepYoung(
 
     if (!current->IsYoungMarked()) {
       const size_t bytes = current->accounting_length();
-      FinalizeAndDelete(current);
+      FinalizeAndDelete(current, batch);
       if (bytes) freed_bytes += bytes;
     } else {
       if ((treat_all_young_as_promoted_ == TreatAllYoungAsPromoted::kYes) ||
@@ -552,6 +719,7 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepYoung(
     current = next;
   }
 
+  heap_->array_buffer_sweeper()->releaser_->Release(std::move(release_batch));
   state_.freed_bytes_ += freed_bytes;
   // Update young/old_bytes_accounted_; the worker may see a difference between
   // this and `initial_young/old_bytes_` due to concurrent main thread
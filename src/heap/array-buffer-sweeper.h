@@ -5,7 +5,9 @@
 #ifndef V8_HEAP_ARRAY_BUFFER_SWEEPER_H_
 #define V8_HEAP_ARRAY_BUFFER_SWEEPER_H_
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "include/v8-external-memory-accounter.h"
 #include "include/v8config.h"
@@ -19,6 +21,7 @@ namespace v8 {
 namespace internal {
 
 class ArrayBufferExtension;
+class BackingStore;
 class Heap;
 
 // Singly linked-list of ArrayBufferExtensions that stores head and tail of the
@@ -71,6 +74,11 @@ class ArrayBufferSweeper final {
   // Detaches an ArrayBufferExtension.
   void Detach(ArrayBufferExtension* extension);
 
+  // Drops the reference to a backing store that was removed from an array
+  // buffer on the main thread. If this is the last reference, deallocation may
+  // be deferred to a background job (see --background-array-buffer-release).
+  void ReleaseBackingStore(std::shared_ptr<BackingStore> backing_store);
+
   const ArrayBufferList& young() const { return young_; }
   const ArrayBufferList& old() const { return old_; }
 
@@ -81,9 +89,14 @@ class ArrayBufferSweeper final {
 
   bool sweeping_in_progress() const { return state_.get(); }
 
+  // Bytes of backing stores that are unreachable and accounted as freed but
+  // are still waiting for deallocation on a background job.
+  size_t PendingReleaseBytes() const;
+
   uint64_t GetTraceIdForFlowEvent(GCTracer::Scope::ScopeId scope_id) const;
 
  private:
+  class BackingStoreReleaser;
   class SweepingState;
 
   // Finishes sweeping if it is already done.
@@ -104,10 +117,20 @@ class ArrayBufferSweeper final {
 
   void ReleaseAll(ArrayBufferList* extension);
 
-  static void FinalizeAndDelete(ArrayBufferExtension* extension);
+  // Returns whether unreachable backing stores that are found on the main
+  // thread should be handed to `releaser_` instead of being deallocated inline.
+  bool ShouldReleaseInBackground() const;
+
+  // Deletes `extension`. If `batch` is provided and the extension holds the
+  // last reference to a large backing store, the backing store is moved to
+  // `batch` instead of being deallocated.
+  static void FinalizeAndDelete(
+      ArrayBufferExtension* extension,
+      std::vector<std::shared_ptr<BackingStore>>* batch = nullptr);
 
   Heap* const heap_;
   std::unique_ptr<SweepingState> state_;
+  std::unique_ptr<BackingStoreReleaser> releaser_;
   ArrayBufferList young_{ArrayBufferList::Age::kYoung};
   ArrayBufferList old_{ArrayBufferList::Age::kOld};
   // Track accounting bytes adjustment during sweeping including freeing, and
@@ -189,6 +189,13 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   }
 #endif  // defined(V8_TARGET_OS_IOS) || defined(V8_TARGET_OS_CHROMEOS)
 
+  if (v8_flags.huge_page_regions) {
+    // The bounded page allocator places code pages best-fit with coalescing,
+    // which keeps them densely packed. Let the kernel back fully populated 2MB
+    // extents of the range with huge pages.
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(base()), size()));
+  }
+
 #ifdef V8_ENABLE_SANDBOX_HARDWARE_SUPPORT
   // Sandboxed code should never write to code space.
   SandboxHardwareSupport::RegisterOutOfSandboxMemory(
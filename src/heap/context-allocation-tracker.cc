@@ -0,0 +1,118 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/context-allocation-tracker.h"
+
+#include <optional>
+
+#include "src/api/api-inl.h"
+#include "src/execution/isolate-inl.h"
+#include "src/heap/heap.h"
+#include "src/objects/contexts-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+std::optional<uintptr_t> GetContextId(Tagged<NativeContext> context) {
+  Tagged<Object> id = context->recorder_context_id();
+  if (!IsSmi(id)) return {};
+  return static_cast<uintptr_t>(Smi::ToInt(id));
+}
+
+}  // namespace
+
+ContextAllocationTracker::ContextAllocationTracker(Heap* heap)
+    : AllocationObserver(kStepSizeInBytes), heap_(heap) {}
+
+ContextAllocationTracker::~ContextAllocationTracker() = default;
+
+void ContextAllocationTracker::SetLimit(DirectHandle<NativeContext> context,
+                                        size_t limit_in_bytes) {
+  Isolate* isolate = heap_->isolate();
+  // The recorder context id also takes care of calling RemoveContext() once
+  // the context dies.
+  if (isolate->GetOrRegisterRecorderContextId(context).IsEmpty()) return;
+  const uintptr_t id = GetContextId(*context).value();
+  auto [it, inserted] = entries_.try_emplace(id);
+  Entry& entry = it->second;
+  if (inserted) {
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
+    v8::HandleScope handle_scope(v8_isolate);
+    entry.context.Reset(v8_isolate, ToApiHandle<v8::Context>(context));
+    entry.context.SetWeak();
+  }
+  entry.limit_in_bytes = limit_in_bytes;
+  entry.limit_reported = false;
+}
+
+size_t ContextAllocationTracker::AllocatedBytes(
+    Tagged<NativeContext> context) const {
+  const std::optional<uintptr_t> id = GetContextId(context);
+  if (!id) return 0;
+  const auto it = entries_.find(*id);
+  if (it == entries_.end()) return 0;
+  return it->second.allocated_bytes;
+}
+
+void ContextAllocationTracker::SetCallback(
+    v8::ContextAllocationLimitCallback callback, void* data) {
+  callback_ = callback;
+  callback_data_ = data;
+}
+
+void ContextAllocationTracker::RemoveContext(uintptr_t context_id) {
+  entries_.erase(context_id);
+}
+
+void ContextAllocationTracker::Step(int bytes_allocated, Address soon_object,
+                                    size_t size) {
+  Isolate* isolate = heap_->isolate();
+  Tagged<Context> context = isolate->context();
+  if (context.is_null() || !IsContext(context)) return;
+  const std::optional<uintptr_t> id =
+      GetContextId(context->native_context());
+  if (!id) return;
+  const auto it = entries_.find(*id);
+  if (it == entries_.end()) return;
+  Entry& entry = it->second;
+  entry.allocated_bytes += bytes_allocated;
+  if (entry.limit_in_bytes == 0 || entry.limit_reported ||
+      entry.allocated_bytes < entry.limit_in_bytes) {
+    return;
+  }
+  entry.limit_reported = true;
+  exceeded_contexts_.push_back(*id);
+  if (interrupt_requested_) return;
+  interrupt_requested_ = true;
+  // Calling into the embedder is not safe in the middle of an allocation.
+  isolate->RequestInterrupt(&InvokeCallbackInterrupt, this);
+}
+
+// static
+void ContextAllocationTracker::InvokeCallbackInterrupt(v8::Isolate* isolate,
+                                                       void* data) {
+  static_cast<ContextAllocationTracker*>(data)->InvokeCallback();
+}
+
+void ContextAllocationTracker::InvokeCallback() {
+  interrupt_requested_ = false;
+  std::vector<uintptr_t> exceeded_contexts;
+  exceeded_contexts.swap(exceeded_contexts_);
+  if (!callback_) return;
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(heap_->isolate());
+  for (uintptr_t id : exceeded_contexts) {
+    // The callback may register contexts or trigger GCs that remove them, so
+    // entries are looked up again for every context.
+    const auto it = entries_.find(id);
+    if (it == entries_.end() || it->second.context.IsEmpty()) continue;
+    v8::HandleScope handle_scope(v8_isolate);
+    callback_(it->second.context.Get(v8_isolate), it->second.allocated_bytes,
+              callback_data_);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
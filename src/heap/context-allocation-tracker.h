@@ -0,0 +1,72 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
+#define V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-callbacks.h"
+#include "include/v8-persistent-handle.h"
+#include "src/handles/handles.h"
+#include "src/heap/allocation-observer.h"
+#include "src/objects/contexts.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Attributes main thread allocations to the native context that is current
+// when an allocation step is reached, and reports contexts that exceed their
+// soft limit to the embedder. Only contexts registered with SetLimit() are
+// accounted. They are keyed by their recorder context id, which is stable
+// across GCs.
+class ContextAllocationTracker final : public AllocationObserver {
+ public:
+  static constexpr intptr_t kStepSizeInBytes = 32 * KB;
+
+  explicit ContextAllocationTracker(Heap* heap);
+  ~ContextAllocationTracker() override;
+
+  ContextAllocationTracker(const ContextAllocationTracker&) = delete;
+  ContextAllocationTracker& operator=(const ContextAllocationTracker&) = delete;
+
+  // Starts accounting `context` if needed and (re-)arms its limit. A limit of
+  // 0 only accounts.
+  void SetLimit(DirectHandle<NativeContext> context, size_t limit_in_bytes);
+  size_t AllocatedBytes(Tagged<NativeContext> context) const;
+  void SetCallback(v8::ContextAllocationLimitCallback callback, void* data);
+
+  // Called when the context with the given recorder context id died.
+  void RemoveContext(uintptr_t context_id);
+
+  void Step(int bytes_allocated, Address soon_object, size_t size) override;
+
+ private:
+  struct Entry {
+    // Weak.
+    v8::Global<v8::Context> context;
+    size_t allocated_bytes = 0;
+    size_t limit_in_bytes = 0;
+    bool limit_reported = false;
+  };
+
+  static void InvokeCallbackInterrupt(v8::Isolate* isolate, void* data);
+  void InvokeCallback();
+
+  Heap* const heap_;
+  std::unordered_map<uintptr_t, Entry> entries_;
+  // Contexts that exceeded their limit since the last interrupt.
+  std::vector<uintptr_t> exceeded_contexts_;
+  bool interrupt_requested_ = false;
+  v8::ContextAllocationLimitCallback callback_ = nullptr;
+  void* callback_data_ = nullptr;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
@@ -490,6 +490,8 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
 #endif  // !V8_ENABLE_LEAPTIERING
   vector->set_closure_feedback_cell_array(*closure_feedback_cell_array);
   vector->set_parent_feedback_cell(*parent_feedback_cell);
+  vector->set_constructor_allocation_site(*undefined_value(), kReleaseStore,
+                                          SKIP_WRITE_BARRIER);
 
   // TODO(leszeks): Initialize based on the feedback metadata.
   MemsetTagged(ObjectSlot(vector->slots_start()), *undefined_value(), length);
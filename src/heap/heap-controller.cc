@@ -4,6 +4,9 @@
 
 #include "src/heap/heap-controller.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "src/execution/isolate-inl.h"
 #include "src/heap/spaces.h"
 #include "src/tracing/trace-event.h"
@@ -43,6 +46,36 @@ double MemoryController<Trait>::GrowingFactor(
   return factor;
 }
 
+template <typename Trait>
+double MemoryController<Trait>::PauseTargetGrowingFactor(
+    Heap* heap, size_t max_heap_size, double max_pause_ms, size_t live_size,
+    std::optional<double> atomic_gc_speed, std::optional<double> gc_speed,
+    double mutator_speed, Heap::HeapGrowingMode growing_mode) {
+  const double throughput_factor =
+      GrowingFactor(heap, max_heap_size, gc_speed, mutator_speed, growing_mode);
+  // Memory pressure and explicitly configured factors take precedence.
+  if (growing_mode != Heap::HeapGrowingMode::kDefault ||
+      v8_flags.heap_growing_percent > 0) {
+    return throughput_factor;
+  }
+  if (!gc_speed || mutator_speed == 0) return throughput_factor;
+  const double atomic_pause_ms =
+      atomic_gc_speed ? live_size / *atomic_gc_speed
+                      : std::numeric_limits<double>::infinity();
+  if (atomic_pause_ms <= max_pause_ms) return throughput_factor;
+
+  const double factor =
+      ConcurrentMarkingGrowingFactor(*gc_speed, mutator_speed);
+  if (V8_UNLIKELY(v8_flags.trace_gc_verbose)) {
+    Isolate::FromHeap(heap)->PrintWithTimestamp(
+        "[%s] factor %.1f for pause target %.1f ms (atomic pause %.1f ms, "
+        "gc=%.f, mutator=%.f)\n",
+        Trait::kName, factor, max_pause_ms, atomic_pause_ms, *gc_speed,
+        mutator_speed);
+  }
+  return factor;
+}
+
 template <typename Trait>
 double MemoryController<Trait>::MaxGrowingFactor(uint64_t physical_memory,
                                                  size_t max_heap_size) {
@@ -130,6 +163,21 @@ double MemoryController<Trait>::DynamicGrowingFactor(
   return factor;
 }
 
+// While concurrent marking traces a live size of L at gc_speed, the mutator
+// allocates L * mutator_speed / gc_speed bytes. The limit thus has to leave at
+// least that much room above the live size, otherwise marking is finalized
+// atomically when the limit is reached. The headroom covers marking starting
+// before the limit and fluctuations of the allocation rate.
+template <typename Trait>
+double MemoryController<Trait>::ConcurrentMarkingGrowingFactor(
+    double gc_speed, double mutator_speed) {
+  DCHECK_LT(0, gc_speed);
+  const double factor =
+      1 + Trait::kConcurrentMarkingHeadroom * mutator_speed / gc_speed;
+  return std::clamp(factor, Trait::kMinGrowingFactor,
+                    Trait::kMaxGrowingFactor);
+}
+
 template <typename Trait>
 size_t MemoryController<Trait>::MinimumAllocationLimitGrowingStep(
     Heap::HeapGrowingMode growing_mode) {
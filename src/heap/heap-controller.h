@@ -18,6 +18,9 @@ struct BaseControllerTrait {
   static constexpr double kMaxGrowingFactor = 4.0;
   static constexpr double kConservativeGrowingFactor = 1.3;
   static constexpr double kTargetMutatorUtilization = 0.97;
+  // Multiple of the bytes allocated during concurrent marking that a limit
+  // leaves room for when growing for a pause target.
+  static constexpr double kConcurrentMarkingHeadroom = 2.0;
 };
 
 struct V8HeapTrait : public BaseControllerTrait {
@@ -40,6 +43,18 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
                               double mutator_speed,
                               Heap::HeapGrowingMode growing_mode);
 
+  // Computes the growing factor for an embedder-provided GC pause target, see
+  // v8::HeapGrowingTargets. If a non-incremental collection of |live_size|
+  // bytes fits into the target, this is the regular throughput-oriented
+  // factor. Otherwise pauses are only met if marking finishes concurrently
+  // and the factor is the smallest one that allows for that.
+  static double PauseTargetGrowingFactor(Heap* heap, size_t max_heap_size,
+                                         double max_pause_ms, size_t live_size,
+                                         std::optional<double> atomic_gc_speed,
+                                         std::optional<double> gc_speed,
+                                         double mutator_speed,
+                                         Heap::HeapGrowingMode growing_mode);
+
   static size_t BoundAllocationLimit(Heap* heap, size_t current_size,
                                      uint64_t limit, size_t min_size,
                                      size_t max_size, size_t new_space_capacity,
@@ -50,8 +65,11 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
                                  size_t max_heap_size);
   static double DynamicGrowingFactor(std::optional<double> gc_speed,
                                      double mutator_speed, double max_factor);
+  static double ConcurrentMarkingGrowingFactor(double gc_speed,
+                                               double mutator_speed);
 
   FRIEND_TEST(MemoryControllerTest, HeapGrowingFactor);
+  FRIEND_TEST(MemoryControllerTest, ConcurrentMarkingGrowingFactor);
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
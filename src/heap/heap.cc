@@ -50,6 +50,7 @@
 #include "src/heap/combined-heap.h"
 #include "src/heap/concurrent-marking.h"
 #include "src/heap/conservative-stack-visitor-inl.h"
+#include "src/heap/context-allocation-tracker.h"
 #include "src/heap/cppgc-js/cpp-heap.h"
 #include "src/heap/ephemeron-remembered-set.h"
 #include "src/heap/evacuation-verifier-inl.h"
@@ -403,6 +404,13 @@ size_t Heap::CommittedMemoryExecutable() {
   return static_cast<size_t>(memory_allocator()->SizeExecutable());
 }
 
+size_t Heap::PendingReleaseBytes() const {
+  if (!HasBeenSetUp()) return 0;
+
+  return sweeper_->PendingLargePageReleaseBytes() +
+         array_buffer_sweeper_->PendingReleaseBytes();
+}
+
 void Heap::UpdateMaximumCommitted() {
   if (!HasBeenSetUp()) return;
 
@@ -1055,6 +1063,16 @@ void Heap::RemoveAllocationObserversFromAllSpaces(
   allocator()->RemoveAllocationObserver(observer, new_space_observer);
 }
 
+ContextAllocationTracker* Heap::EnsureContextAllocationTracker() {
+  if (!context_allocation_tracker_) {
+    context_allocation_tracker_ =
+        std::make_unique<ContextAllocationTracker>(this);
+    AddAllocationObserversToAllSpaces(context_allocation_tracker_.get(),
+                                      context_allocation_tracker_.get());
+  }
+  return context_allocation_tracker_.get();
+}
+
 void Heap::PublishMainThreadPendingAllocations() {
   allocator()->PublishPendingAllocations();
 }
@@ -1186,6 +1204,12 @@ void Heap::GarbageCollectionEpilogue(GarbageCollector collector) {
 
   isolate_->counters()->alive_after_last_gc()->Set(
       static_cast<int>(SizeOfObjects()));
+  if (v8_flags.huge_page_regions) {
+    isolate_->counters()->huge_page_regions_kbytes()->Set(
+        static_cast<int>(memory_allocator()->HugePageRegionsSize() / KB));
+    isolate_->counters()->huge_page_regions_kbytes_used()->Set(
+        static_cast<int>(memory_allocator()->HugePageRegionsSizeInUse() / KB));
+  }
 
   if (CommittedMemory() > 0) {
     isolate_->counters()->external_fragmentation_total()->AddSample(
@@ -2523,9 +2547,19 @@ Heap::LimitsComputationResult Heap::ComputeNewAllocationLimits(Heap* heap) {
       heap->tracer()->OldGenerationSpeedInBytesPerMillisecond();
   double v8_mutator_speed =
       heap->tracer()->OldGenerationAllocationThroughputInBytesPerMillisecond();
-  double v8_growing_factor = MemoryController<V8HeapTrait>::GrowingFactor(
-      heap, heap->max_old_generation_size(), v8_gc_speed, v8_mutator_speed,
-      mode);
+  const std::optional<v8::HeapGrowingTargets>& targets =
+      heap->heap_growing_targets_;
+  double v8_growing_factor =
+      (targets && targets->max_gc_pause_ms > 0)
+          ? MemoryController<V8HeapTrait>::PauseTargetGrowingFactor(
+                heap, heap->max_old_generation_size(),
+                targets->max_gc_pause_ms,
+                heap->OldGenerationConsumedBytesAtLastGC(),
+                heap->tracer()->MarkCompactSpeedInBytesPerMillisecond(),
+                v8_gc_speed, v8_mutator_speed, mode)
+          : MemoryController<V8HeapTrait>::GrowingFactor(
+                heap, heap->max_old_generation_size(), v8_gc_speed,
+                v8_mutator_speed, mode);
   std::optional<double> embedder_gc_speed =
       heap->tracer()->EmbedderSpeedInBytesPerMillisecond();
   double embedder_speed =
@@ -2539,11 +2573,34 @@ Heap::LimitsComputationResult Heap::ComputeNewAllocationLimits(Heap* heap) {
 
   size_t new_space_capacity = heap->NewSpaceTargetCapacity();
 
+  // The memory ceiling replaces the maximum size the limits approach, which
+  // makes collections more frequent when getting close to it. Unlike the
+  // maximum size it may be exceeded, so the limits always leave room for
+  // progress.
+  size_t max_old_generation_limit = heap->max_old_generation_size();
+  size_t max_global_limit = heap->max_global_memory_size_;
+  if (targets && targets->memory_ceiling_in_bytes > 0) {
+    const size_t ceiling =
+        targets->memory_ceiling_in_bytes -
+        std::min(targets->memory_ceiling_in_bytes, new_space_capacity);
+    const size_t minimum_growing_step =
+        2 * MemoryController<V8HeapTrait>::MinimumAllocationLimitGrowingStep(
+                mode);
+    max_old_generation_limit = std::min(
+        max_old_generation_limit,
+        std::max(ceiling, heap->OldGenerationConsumedBytesAtLastGC() +
+                              minimum_growing_step));
+    max_global_limit = std::min(
+        max_global_limit,
+        std::max(ceiling,
+                 heap->GlobalConsumedBytesAtLastGC() + minimum_growing_step));
+  }
+
   size_t new_old_generation_allocation_limit =
       MemoryController<V8HeapTrait>::BoundAllocationLimit(
           heap, heap->OldGenerationConsumedBytesAtLastGC(),
           heap->OldGenerationConsumedBytesAtLastGC() * v8_growing_factor,
-          heap->min_old_generation_size_, heap->max_old_generation_size(),
+          heap->min_old_generation_size_, max_old_generation_limit,
           new_space_capacity, mode);
 
   double global_growing_factor =
@@ -2563,8 +2620,8 @@ Heap::LimitsComputationResult Heap::ComputeNewAllocationLimits(Heap* heap) {
                    ? heap->external_memory_.low_since_mark_compact() *
                          external_growing_factor
                    : 0),
-          heap->min_global_memory_size_, heap->max_global_memory_size_,
-          new_space_capacity, mode);
+          heap->min_global_memory_size_, max_global_limit, new_space_capacity,
+          mode);
 
   return {new_old_generation_allocation_limit, new_global_allocation_limit};
 }
@@ -3922,8 +3979,31 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
                              (allocation_throughput != 0) &&
                              (allocation_throughput < kLowAllocationThroughput);
 
+  const std::optional<size_t> pause_target_capacity =
+      NewSpaceCapacityForPauseTarget();
+  if (pause_target_capacity &&
+      new_space_->TotalCapacity() > *pause_target_capacity &&
+      !v8_flags.predictable) {
+    return ResizeNewSpaceMode::kShrink;
+  }
+
+  if (std::optional<size_t> target_capacity = AdaptiveNewSpaceCapacity()) {
+    if (*target_capacity > new_space_->TotalCapacity()) {
+      return ResizeNewSpaceMode::kGrow;
+    }
+    // Only shrink once the target dropped well below the current capacity to
+    // avoid oscillating between sizes.
+    if (!v8_flags.predictable &&
+        *target_capacity <= new_space_->TotalCapacity() / 2) {
+      return ResizeNewSpaceMode::kShrink;
+    }
+    return ResizeNewSpaceMode::kNone;
+  }
+
   const bool should_grow =
-      (new_space_->TotalCapacity() < new_space_->MaximumCapacity()) &&
+      (new_space_->TotalCapacity() <
+       std::min(new_space_->MaximumCapacity(),
+                pause_target_capacity.value_or(SIZE_MAX))) &&
       (survived_since_last_expansion_ > new_space_->TotalCapacity());
 
   if (should_grow) survived_since_last_expansion_ = 0;
@@ -3933,9 +4013,11 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
 }
 
 namespace {
-size_t ComputeReducedNewSpaceSize(NewSpace* new_space) {
+size_t ComputeReducedNewSpaceSize(NewSpace* new_space,
+                                  std::optional<size_t> target_capacity) {
   size_t new_capacity =
-      std::max(new_space->MinimumCapacity(), 2 * new_space->Size());
+      std::max(target_capacity.value_or(new_space->MinimumCapacity()),
+               2 * new_space->Size());
   size_t rounded_new_capacity =
       ::RoundUp(new_capacity, PageMetadata::kPageSize);
   DCHECK_LE(new_space->TotalCapacity(), new_space->MaximumCapacity());
@@ -3948,7 +4030,9 @@ void Heap::StartResizeNewSpace() {
   DCHECK(v8_flags.minor_ms);
   resize_new_space_mode_ = ShouldResizeNewSpace();
   if (resize_new_space_mode_ == ResizeNewSpaceMode::kShrink) {
-    size_t reduced_capacity = ComputeReducedNewSpaceSize(new_space());
+    size_t reduced_capacity = ComputeReducedNewSpaceSize(
+        new_space(), ShouldReduceMemory() ? std::nullopt
+                                          : AdaptiveNewSpaceCapacity());
     paged_new_space()->StartShrinking(reduced_capacity);
   }
 }
@@ -3981,8 +4065,18 @@ void Heap::ExpandNewSpaceSize() {
   const size_t suggested_capacity =
       static_cast<size_t>(v8_flags.semi_space_growth_factor) *
       new_space_->TotalCapacity();
-  const size_t chosen_capacity =
+  size_t chosen_capacity =
       std::min(suggested_capacity, new_space_->MaximumCapacity());
+  if (std::optional<size_t> target_capacity = AdaptiveNewSpaceCapacity()) {
+    chosen_capacity = *target_capacity;
+  }
+  if (std::optional<size_t> pause_target_capacity =
+          NewSpaceCapacityForPauseTarget()) {
+    const size_t max_capacity =
+        ::RoundDown(*pause_target_capacity, PageMetadata::kPageSize);
+    chosen_capacity = std::max(new_space_->TotalCapacity(),
+                               std::min(chosen_capacity, max_capacity));
+  }
   DCHECK(IsAligned(chosen_capacity, PageMetadata::kPageSize));
 
   if (chosen_capacity > new_space_->TotalCapacity()) {
@@ -3993,7 +4087,9 @@ void Heap::ExpandNewSpaceSize() {
 
 void Heap::ReduceNewSpaceSize() {
   if (!v8_flags.minor_ms) {
-    const size_t reduced_capacity = ComputeReducedNewSpaceSize(new_space());
+    const size_t reduced_capacity = ComputeReducedNewSpaceSize(
+        new_space(), ShouldReduceMemory() ? std::nullopt
+                                          : AdaptiveNewSpaceCapacity());
     semi_space_new_space()->Shrink(reduced_capacity);
   } else {
     // MinorMS starts shrinking new space as part of sweeping.
@@ -4002,6 +4098,52 @@ void Heap::ReduceNewSpaceSize() {
   new_lo_space_->SetCapacity(new_space()->TotalCapacity());
 }
 
+std::optional<size_t> Heap::NewSpaceCapacityForPauseTarget() const {
+  if (!new_space_ || !heap_growing_targets_ ||
+      heap_growing_targets_->max_gc_pause_ms == 0) {
+    return {};
+  }
+  // A young generation collection copies the surviving part of new space in
+  // its atomic pause.
+  const std::optional<double> speed =
+      tracer()->YoungGenerationSpeedInBytesPerMillisecond(
+          YoungGenerationSpeedMode::kOnlyAtomicPause);
+  const double survival_ratio = tracer()->AverageSurvivalRatio() / 100;
+  if (!speed || survival_ratio == 0) return {};
+  const double capacity =
+      heap_growing_targets_->max_gc_pause_ms * *speed / survival_ratio;
+  return std::max(new_space_->MinimumCapacity(),
+                  static_cast<size_t>(std::min(
+                      capacity, static_cast<double>(SIZE_MAX))));
+}
+
+std::optional<size_t> Heap::AdaptiveNewSpaceCapacity() const {
+  if (!v8_flags.adaptive_new_space_sizing || !new_space_) return {};
+  const double allocation_throughput =
+      new_space_allocation_throughput_for_testing_.value_or(
+          tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond());
+  if (allocation_throughput == 0) return {};
+  // Surviving objects are copied by every young generation collection, so with
+  // high survival ratios a larger new space mostly adds work. Shorten the
+  // interval proportionally once the survival ratio exceeds the target.
+  const double survival_percent = tracer()->AverageSurvivalRatio();
+  double interval_ms = v8_flags.new_space_target_collection_interval_ms;
+  if (survival_percent > v8_flags.new_space_target_survival_percent) {
+    interval_ms *=
+        v8_flags.new_space_target_survival_percent / survival_percent;
+  }
+  double capacity = allocation_throughput * interval_ms;
+  if (std::optional<size_t> pause_target_capacity =
+          NewSpaceCapacityForPauseTarget()) {
+    capacity = std::min(capacity, static_cast<double>(*pause_target_capacity));
+  }
+  const size_t max_capacity = new_space_->MaximumCapacity();
+  capacity = std::min(capacity, static_cast<double>(max_capacity));
+  return std::clamp(
+      ::RoundUp(static_cast<size_t>(capacity), PageMetadata::kPageSize),
+      new_space_->MinimumCapacity(), max_capacity);
+}
+
 size_t Heap::NewSpaceSize() {
   if (v8_flags.sticky_mark_bits) {
     return sticky_space()->young_objects_size();
@@ -4371,6 +4513,28 @@ void Heap::AutomaticallyRestoreInitialHeapLimit(double threshold_percent) {
       initial_max_old_generation_size_ * threshold_percent;
 }
 
+void Heap::SetHeapGrowingTargets(const v8::HeapGrowingTargets& targets) {
+  if (targets.max_gc_pause_ms == 0 && targets.memory_ceiling_in_bytes == 0) {
+    heap_growing_targets_.reset();
+  } else {
+    heap_growing_targets_ = targets;
+  }
+}
+
+std::optional<double> Heap::CompactionPauseTargetMs() const {
+  // Share of the embedder's pause target that is given to evacuation. The rest
+  // is left for marking finalization and sweeping.
+  static constexpr double kCompactionShareOfPauseTarget = 0.5;
+  if (v8_flags.compaction_pause_target_ms > 0) {
+    return v8_flags.compaction_pause_target_ms;
+  }
+  if (heap_growing_targets_ && heap_growing_targets_->max_gc_pause_ms > 0) {
+    return kCompactionShareOfPauseTarget *
+           heap_growing_targets_->max_gc_pause_ms;
+  }
+  return {};
+}
+
 bool Heap::InvokeNearHeapLimitCallback() {
   if (!near_heap_limit_callbacks_.empty()) {
     AllowGarbageCollection allow_gc;
@@ -6439,6 +6603,12 @@ void Heap::TearDown() {
     stress_scavenge_observer_ = nullptr;
   }
 
+  if (context_allocation_tracker_) {
+    RemoveAllocationObserversFromAllSpaces(context_allocation_tracker_.get(),
+                                           context_allocation_tracker_.get());
+    context_allocation_tracker_.reset();
+  }
+
   if (mark_compact_collector_) {
     mark_compact_collector_->TearDown();
     mark_compact_collector_.reset();
@@ -87,6 +87,7 @@ class CodeLargeObjectSpace;
 class CodeRange;
 class CollectionBarrier;
 class ConcurrentMarking;
+class ContextAllocationTracker;
 class CppHeap;
 class EphemeronRememberedSet;
 class GCTracer;
@@ -437,6 +438,10 @@ class Heap final {
   size_t NewSpaceCapacity() const;
   size_t NewSpaceTargetCapacity() const;
 
+  // Returns the new space capacity --adaptive-new-space-sizing aims for, or
+  // nothing if the policy is disabled or lacks allocation data.
+  std::optional<size_t> AdaptiveNewSpaceCapacity() const;
+
   // Move `len` tagged elements from `src_slot` to `dst_slot` of `dst_object`.
   // The source and destination memory ranges can overlap.
   template <typename TSlot>
@@ -606,6 +611,14 @@ class Heap final {
   V8_EXPORT_PRIVATE void AutomaticallyRestoreInitialHeapLimit(
       double threshold_percent);
 
+  V8_EXPORT_PRIVATE void SetHeapGrowingTargets(
+      const v8::HeapGrowingTargets& targets);
+
+  // Returns the time a full GC may spend evacuating objects in its atomic
+  // pause, either from --compaction-pause-target-ms or derived from the
+  // embedder's pause target.
+  std::optional<double> CompactionPauseTargetMs() const;
+
   V8_EXPORT_PRIVATE void AppendArrayBufferExtension(
       ArrayBufferExtension* extension);
   V8_EXPORT_PRIVATE void ResizeArrayBufferExtension(
@@ -1339,6 +1352,11 @@ class Heap final {
   // Returns the amount of physical memory currently committed for the heap.
   size_t CommittedPhysicalMemory();
 
+  // Returns the amount of memory that is already dead but not yet returned to
+  // the system by background threads, i.e., large object pages pending release
+  // on the sweeper and array buffer backing stores pending deallocation.
+  V8_EXPORT_PRIVATE size_t PendingReleaseBytes() const;
+
   // Returns the maximum amount of memory ever committed for the heap.
   size_t MaximumCommittedMemory() { return maximum_committed_; }
 
@@ -1396,6 +1414,12 @@ class Heap final {
     new_space_allocation_counter_ = new_value;
   }
 
+  // Replaces the measured new space allocation throughput that
+  // --adaptive-new-space-sizing is based on.
+  void SetNewSpaceAllocationThroughputForTesting(double throughput) {
+    new_space_allocation_throughput_for_testing_ = throughput;
+  }
+
   void UpdateOldGenerationAllocationCounter() {
     old_generation_allocation_counter_at_last_gc_ =
         OldGenerationAllocationCounter();
@@ -1875,6 +1899,10 @@ class Heap final {
   void ExpandNewSpaceSize();
   void ReduceNewSpaceSize();
 
+  // Returns the largest new space capacity whose scavenges are expected to
+  // stay within the embedder-provided pause target, if any.
+  std::optional<size_t> NewSpaceCapacityForPauseTarget() const;
+
   void PrintMaxMarkingLimitReached();
   void PrintMaxNewSpaceSizeReached();
 
@@ -2125,6 +2153,12 @@ class Heap final {
   std::vector<Tagged<WeakArrayList>> FindAllRetainedMaps();
   MemoryMeasurement* memory_measurement() { return memory_measurement_.get(); }
 
+  ContextAllocationTracker* context_allocation_tracker() {
+    return context_allocation_tracker_.get();
+  }
+  // Creates the tracker on first use, which starts observing allocations.
+  ContextAllocationTracker* EnsureContextAllocationTracker();
+
   AllocationType allocation_type_for_in_place_internalizable_strings() const {
     return allocation_type_for_in_place_internalizable_strings_;
   }
@@ -2188,6 +2222,10 @@ class Heap final {
   // different behavior in NotifyContextDisposed().
   bool preconfigured_old_generation_size_ = false;
 
+  // Embedder-provided targets for the heap growing heuristics. Unset when the
+  // default heuristics are used.
+  std::optional<v8::HeapGrowingTargets> heap_growing_targets_;
+
   size_t maximum_committed_ = 0;
   size_t old_generation_capacity_after_bootstrap_ = 0;
 
@@ -2348,6 +2386,7 @@ class Heap final {
   std::unique_ptr<IncrementalMarking> incremental_marking_;
   std::unique_ptr<ConcurrentMarking> concurrent_marking_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
+  std::unique_ptr<ContextAllocationTracker> context_allocation_tracker_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
@@ -2459,6 +2498,7 @@ class Heap final {
   bool force_oom_ = false;
   bool force_gc_on_next_allocation_ = false;
   bool delay_sweeper_tasks_for_testing_ = false;
+  std::optional<double> new_space_allocation_throughput_for_testing_;
 
   std::vector<HeapObjectAllocationTracker*> allocation_trackers_;
 
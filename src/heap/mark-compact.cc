@@ -363,6 +363,8 @@ bool MarkCompactCollector::StartCompaction(StartCompactionMode mode) {
     return false;
   }
 
+  evacuation_budget_ = ComputeEvacuationBudget();
+
   CollectEvacuationCandidates(heap_->old_space());
 
   // Don't compact shared space when CSS is enabled, since there may be
@@ -381,6 +383,7 @@ bool MarkCompactCollector::StartCompaction(StartCompactionMode mode) {
     TraceFragmentation(heap_->code_space());
   }
 
+  evacuation_budget_.reset();
   compacting_ = !evacuation_candidates_.empty();
   return compacting_;
 }
@@ -598,7 +601,6 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   // defaults to start and switch to a trace-based (using compaction speed)
   // approach as soon as we have enough samples.
   const int kTargetFragmentationPercent = 70;
-  const size_t kMaxEvacuatedBytes = 4 * MB;
   // Time to take for a single area (=payload of page). Used as soon as there
   // exist enough compaction speed samples.
   const float kTargetMsPerArea = .5;
@@ -628,10 +630,34 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
     } else {
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
-    *max_evacuated_bytes = kMaxEvacuatedBytes;
+    // With a pause target, the remaining budget replaces the fixed quota. The
+    // most fragmented pages are compacted first and the rest is left to
+    // subsequent GCs.
+    *max_evacuated_bytes = evacuation_budget_.value_or(kMaxEvacuatedBytes);
   }
 }
 
+std::optional<size_t> MarkCompactCollector::ComputeEvacuationBudget() const {
+  if (heap_->ShouldReduceMemory() || heap_->ShouldOptimizeForMemoryUsage()) {
+    return {};
+  }
+  const std::optional<double> pause_target_ms =
+      heap_->CompactionPauseTargetMs();
+  if (!pause_target_ms) return {};
+  const std::optional<double> compaction_speed =
+      heap_->tracer()->CompactionSpeedInBytesPerMillisecond();
+  if (!compaction_speed) return {};
+  // The compaction speed is measured per evacuation task. Assuming a single
+  // task keeps the estimate conservative and accounts for pointer updating,
+  // which is not part of the measured speed.
+  const size_t budget = static_cast<size_t>(std::min(
+      *pause_target_ms * *compaction_speed, static_cast<double>(SIZE_MAX)));
+  // A target derived from the embedder's pause target only ever shortens
+  // pauses. An explicit flag may also allow longer ones.
+  if (v8_flags.compaction_pause_target_ms > 0) return budget;
+  return std::min(budget, kMaxEvacuatedBytes);
+}
+
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   DCHECK(space->identity() == OLD_SPACE || space->identity() == CODE_SPACE ||
          space->identity() == SHARED_SPACE ||
@@ -772,6 +798,12 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     for (int i = 0; i < candidate_count; i++) {
       AddEvacuationCandidate(pages[i].second);
     }
+    if (in_standard_path && evacuation_budget_ && candidate_count > 0) {
+      // Modes that select pages regardless of the budget, like
+      // --compact-on-every-full-gc, are not charged. Saturate anyway so that
+      // the budget never wraps around.
+      *evacuation_budget_ -= std::min(total_live_bytes, *evacuation_budget_);
+    }
   }
 
   if (v8_flags.trace_fragmentation) {
@@ -929,6 +961,11 @@ void MarkCompactCollector::Finish() {
   local_weak_objects_.reset();
   weak_objects_.next_ephemerons.Clear();
 
+  if (v8_flags.concurrent_large_page_release) {
+    sweeper_->AddLargePagesForRelease(
+        heap_->memory_allocator()->TakeDelayedThenReleasedLargePages());
+  }
+
   sweeper_->StartMajorSweeperTasks();
 
   // Release delayed pages now that the pointer-update phase is done.
@@ -6195,7 +6232,11 @@ void MarkCompactCollector::SweepLargeSpace(LargeObjectSpace* space) {
     // doesn't support `kPool` for large pages, so we choose `kDelayThenPool`.
     DCHECK_IMPLIES(add_to_pool, !delay_freeing);
     free_mode = MemoryAllocator::FreeMode::kDelayThenPool;
-  } else if (delay_freeing) {
+  } else if (delay_freeing || (v8_flags.concurrent_large_page_release &&
+                                space->identity() != CODE_LO_SPACE)) {
+    // With --concurrent-large-page-release delayed pages are released by the
+    // sweeper tasks after the pause. Executable pages are always released
+    // right away.
     free_mode = MemoryAllocator::FreeMode::kDelayThenRelease;
   } else {
     free_mode = MemoryAllocator::FreeMode::kImmediately;
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_MARK_COMPACT_H_
 #define V8_HEAP_MARK_COMPACT_H_
 
+#include <optional>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
@@ -21,6 +22,10 @@
 namespace v8 {
 namespace internal {
 
+namespace heap {
+class HeapTester;
+}  // namespace heap
+
 // Forward declarations.
 class HeapObjectVisitor;
 class LargeObjectSpace;
@@ -195,9 +200,19 @@ class MarkCompactCollector final {
  private:
   using ResizeNewSpaceMode = Heap::ResizeNewSpaceMode;
 
+  // Evacuation quota of latency-critical GCs without a pause target.
+  static constexpr size_t kMaxEvacuatedBytes = 4 * MB;
+
   void ComputeEvacuationHeuristics(size_t area_size,
                                    int* target_fragmentation_percent,
                                    size_t* max_evacuated_bytes);
+  // Returns the number of bytes that can be evacuated within
+  // Heap::CompactionPauseTargetMs(), if there is a target and enough samples
+  // to estimate the compaction speed. Only an explicit
+  // --compaction-pause-target-ms may exceed kMaxEvacuatedBytes, so a target
+  // set by the embedder can only shrink the evacuation quota. Evacuation
+  // itself stays atomic.
+  std::optional<size_t> ComputeEvacuationBudget() const;
 
   void RecordObjectStats();
 
@@ -417,6 +432,10 @@ class MarkCompactCollector final {
   // True if we are collecting slots to perform evacuation from evacuation
   // candidates.
   bool compacting_ = false;
+
+  // Bytes that may still be selected for evacuation in the current cycle when
+  // compaction is bounded by a pause target. Shared by all spaces.
+  std::optional<size_t> evacuation_budget_;
   bool black_allocation_ = false;
   bool have_code_to_deoptimize_ = false;
   bool parallel_marking_ = false;
@@ -476,6 +495,9 @@ class MarkCompactCollector final {
   friend class RecordMigratedSlotVisitor;
   friend class RootMarkingVisitor;
   friend class PrecisePagePinningVisitor;
+
+  // Used in cctest.
+  friend class heap::HeapTester;
 };
 
 }  // namespace internal
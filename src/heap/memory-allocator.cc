@@ -4,11 +4,14 @@
 
 #include "src/heap/memory-allocator.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <optional>
 
 #include "src/base/address-region.h"
+#include "src/base/bits.h"
 #include "src/base/macros.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -63,6 +66,8 @@ void MemoryAllocator::TearDown() {
     reserved_chunk_at_virtual_memory_limit_->Free();
   }
 
+  huge_page_regions_.TearDown();
+
   code_page_allocator_ = nullptr;
   data_page_allocator_ = nullptr;
   read_only_page_allocator_ = nullptr;
@@ -85,6 +90,9 @@ void MemoryAllocator::ReleasePooledChunksImmediately() {
   if (auto* pool = memory_pool()) {
     pool->ReleaseImmediately(isolate_);
   }
+  // Free slots of huge page regions are not pooled but hold on to their
+  // memory the same way.
+  huge_page_regions_.DiscardFreePages();
 }
 
 void MemoryAllocator::FreeMemoryRegion(v8::PageAllocator* page_allocator,
@@ -356,11 +364,32 @@ void MemoryAllocator::PerformFreeMemory(MutablePageMetadata* chunk_metadata) {
   DCHECK(chunk_metadata->is_pre_freed());
   DCHECK(!chunk_metadata->Chunk()->InReadOnlySpace());
 
+  const Address chunk_address = chunk_metadata->ChunkAddress();
+  if (huge_page_regions_.Contains(chunk_address)) {
+    DCHECK(!chunk_metadata->is_large());
+    // The memory of the page belongs to its region and is released together
+    // with it.
+    chunk_metadata->reserved_memory()->Reset();
+    static_cast<PageMetadata*>(chunk_metadata)->~PageMetadata();
+    free(chunk_metadata);
+    huge_page_regions_.FreePage(chunk_address);
+    return;
+  }
+
   DeleteMemoryChunk(chunk_metadata);
 }
 
 void MemoryAllocator::Free(MemoryAllocator::FreeMode mode,
                            MutablePageMetadata* page_metadata) {
+  // Pages in huge page regions never enter the pool as that would release
+  // them individually.
+  if (huge_page_regions_.Contains(page_metadata->ChunkAddress())) {
+    if (mode == FreeMode::kPool) {
+      mode = FreeMode::kImmediately;
+    } else if (mode == FreeMode::kDelayThenPool) {
+      mode = FreeMode::kDelayThenRelease;
+    }
+  }
   PreFreeMemory(page_metadata);
   switch (mode) {
     case FreeMode::kImmediately:
@@ -422,13 +451,30 @@ void MemoryAllocator::ReleaseDelayedPages() {
   delayed_then_released_pages_.clear();
 }
 
+std::vector<LargePageMetadata*>
+MemoryAllocator::TakeDelayedThenReleasedLargePages() {
+  std::vector<LargePageMetadata*> large_pages;
+  auto it = std::remove_if(
+      delayed_then_released_pages_.begin(), delayed_then_released_pages_.end(),
+      [&large_pages](MutablePageMetadata* page) {
+        if (!page->is_large() || page->is_executable()) return false;
+        large_pages.push_back(static_cast<LargePageMetadata*>(page));
+        return true;
+      });
+  delayed_then_released_pages_.erase(it, delayed_then_released_pages_.end());
+  return large_pages;
+}
+
 PageMetadata* MemoryAllocator::AllocatePage(
     MemoryAllocator::AllocationMode alloc_mode, Space* space,
     Executability executable) {
   const size_t size =
       MemoryChunkLayout::AllocatableMemoryInMemoryChunk(space->identity());
   std::optional<MemoryChunkAllocationResult> chunk_info;
-  if (alloc_mode == AllocationMode::kTryDelayedAndPooled) {
+  if (HugePageRegions::IsEnabledFor(space->identity(), executable)) {
+    chunk_info = AllocateUninitializedPageFromHugePageRegion(space);
+  }
+  if (!chunk_info && alloc_mode == AllocationMode::kTryDelayedAndPooled) {
     DCHECK_EQ(executable, NOT_EXECUTABLE);
     chunk_info = AllocateUninitializedPageFromDelayedOrPool(space);
   }
@@ -628,6 +674,35 @@ MemoryAllocator::AllocateUninitializedPageFromDelayedOrPool(Space* space) {
   };
 }
 
+std::optional<MemoryAllocator::MemoryChunkAllocationResult>
+MemoryAllocator::AllocateUninitializedPageFromHugePageRegion(Space* space) {
+  const AllocationSpace identity = space->identity();
+  const size_t area_size =
+      MemoryChunkLayout::AllocatableMemoryInMemoryChunk(identity);
+  const size_t chunk_size = ComputeChunkSize(area_size, identity);
+  DCHECK_LE(chunk_size, kRegularPageSize);
+  v8::PageAllocator* page_allocator = this->page_allocator(identity);
+  const Address start = huge_page_regions_.AllocatePage(page_allocator);
+  if (start == kNullAddress) return {};
+
+  VirtualMemory reservation(page_allocator, start, chunk_size);
+  if (heap::ShouldZapGarbage()) {
+    heap::ZapBlock(start, chunk_size, kZapValue);
+  }
+  size_ += chunk_size;
+  UpdateAllocatedSpaceLimits(start, start + chunk_size,
+                             Executability::NOT_EXECUTABLE);
+  LOG(isolate_,
+      NewEvent("MemoryChunk", reinterpret_cast<void*>(start), chunk_size));
+  const Address area_start =
+      start + MemoryChunkLayout::ObjectStartOffsetInMemoryChunk(identity);
+  return MemoryChunkAllocationResult{
+      reinterpret_cast<void*>(start), nullptr,
+      chunk_size,                     area_start,
+      area_start + area_size,         std::move(reservation),
+  };
+}
+
 std::optional<MemoryAllocator::MemoryChunkAllocationResult>
 MemoryAllocator::TryAllocateUninitializedLargePageFromPool(Space* space,
                                                            size_t object_size) {
@@ -828,4 +903,134 @@ void MemoryAllocator::UnregisterExecutableMemoryChunk(
 }
 #endif  // DEBUG
 
+// static
+bool MemoryAllocator::HugePageRegions::IsEnabledFor(AllocationSpace space,
+                                                    Executability executable) {
+  if (kPagesPerRegion < 2 || !v8_flags.huge_page_regions) return false;
+  if (executable == EXECUTABLE) return false;
+  switch (space) {
+    case OLD_SPACE:
+    case SHARED_SPACE:
+    case TRUSTED_SPACE:
+    case SHARED_TRUSTED_SPACE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// static
+MemoryAllocator::HugePageRegions::PartialRegionKey
+MemoryAllocator::HugePageRegions::GetPartialRegionKey(Address start,
+                                                      const Region& region) {
+  const size_t free_slots =
+      kPagesPerRegion - base::bits::CountPopulation(region.used_slots);
+  return {region.reservation.page_allocator(), free_slots, start};
+}
+
+Address MemoryAllocator::HugePageRegions::AllocatePage(
+    v8::PageAllocator* page_allocator) {
+  base::MutexGuard guard(&mutex_);
+  // Prefer the fullest region to keep the number of partially used regions
+  // low.
+  Region* target = nullptr;
+  Address target_start = kNullAddress;
+  auto it = partial_regions_.lower_bound(
+      PartialRegionKey{page_allocator, 1, kNullAddress});
+  if (it != partial_regions_.end() && std::get<0>(*it) == page_allocator) {
+    target_start = std::get<2>(*it);
+    target = &regions_.at(target_start);
+    partial_regions_.erase(it);
+  } else {
+    VirtualMemory reservation(page_allocator, kRegionSize, {}, kRegionSize,
+                              PageAllocator::kReadWrite);
+    if (!reservation.IsReserved()) return kNullAddress;
+    target_start = reservation.address();
+    DCHECK(IsAligned(target_start, kRegionSize));
+    // Pages at the very end of the address space cannot be used for linear
+    // allocation, see MemoryAllocator::AllocateAlignedMemory().
+    if (target_start + kRegionSize == 0u) return kNullAddress;
+    // The hint is advisory; pages in the region still work without it.
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(target_start),
+                                  kRegionSize));
+    size_.fetch_add(kRegionSize, std::memory_order_relaxed);
+    target = &regions_.emplace(target_start, Region{std::move(reservation)})
+                  .first->second;
+  }
+  const size_t slot = base::bits::CountTrailingZeros(~target->used_slots);
+  DCHECK_LT(slot, kPagesPerRegion);
+  const uint32_t slot_bit = uint32_t{1} << slot;
+  target->used_slots |= slot_bit;
+  if (target->discarded_slots & slot_bit) {
+    // Discarded memory stays accessible and is faulted in again on use.
+    target->discarded_slots &= ~slot_bit;
+    size_discarded_.fetch_sub(kRegularPageSize, std::memory_order_relaxed);
+  }
+  if (base::bits::CountPopulation(target->used_slots) < kPagesPerRegion) {
+    partial_regions_.insert(GetPartialRegionKey(target_start, *target));
+  }
+  size_in_use_.fetch_add(kRegularPageSize, std::memory_order_relaxed);
+  return target_start + slot * kRegularPageSize;
+}
+
+void MemoryAllocator::HugePageRegions::FreePage(Address page) {
+  base::MutexGuard guard(&mutex_);
+  auto it = regions_.find(RoundDown(page, kRegionSize));
+  DCHECK_NE(it, regions_.end());
+  Region& region = it->second;
+  const uint32_t slot_bit = uint32_t{1}
+                            << ((page - it->first) / kRegularPageSize);
+  DCHECK(region.used_slots & slot_bit);
+  partial_regions_.erase(GetPartialRegionKey(it->first, region));
+  region.used_slots &= ~slot_bit;
+  size_in_use_.fetch_sub(kRegularPageSize, std::memory_order_relaxed);
+  if (region.used_slots == 0) {
+    size_.fetch_sub(kRegionSize, std::memory_order_relaxed);
+    size_discarded_.fetch_sub(
+        base::bits::CountPopulation(region.discarded_slots) * kRegularPageSize,
+        std::memory_order_relaxed);
+    regions_.erase(it);
+    return;
+  }
+  partial_regions_.insert(GetPartialRegionKey(it->first, region));
+}
+
+void MemoryAllocator::HugePageRegions::DiscardFreePages() {
+  static constexpr uint32_t kAllSlots =
+      static_cast<uint32_t>((uint64_t{1} << kPagesPerRegion) - 1);
+  base::MutexGuard guard(&mutex_);
+  for (const PartialRegionKey& key : partial_regions_) {
+    const Address start = std::get<2>(key);
+    Region& region = regions_.at(start);
+    const uint32_t free_slots =
+        ~(region.used_slots | region.discarded_slots) & kAllSlots;
+    for (size_t slot = 0; slot < kPagesPerRegion; slot++) {
+      const uint32_t slot_bit = uint32_t{1} << slot;
+      if (!(free_slots & slot_bit)) continue;
+      if (!region.reservation.DiscardSystemPages(
+              start + slot * kRegularPageSize, kRegularPageSize)) {
+        continue;
+      }
+      region.discarded_slots |= slot_bit;
+      size_discarded_.fetch_add(kRegularPageSize, std::memory_order_relaxed);
+    }
+  }
+}
+
+bool MemoryAllocator::HugePageRegions::Contains(Address address) const {
+  if (size() == 0) return false;
+  base::MutexGuard guard(&mutex_);
+  return regions_.contains(RoundDown(address, kRegionSize));
+}
+
+void MemoryAllocator::HugePageRegions::TearDown() {
+  base::MutexGuard guard(&mutex_);
+  DCHECK_EQ(0u, size_in_use());
+  regions_.clear();
+  partial_regions_.clear();
+  size_.store(0, std::memory_order_relaxed);
+  size_in_use_.store(0, std::memory_order_relaxed);
+  size_discarded_.store(0, std::memory_order_relaxed);
+}
+
 }  // namespace v8::internal
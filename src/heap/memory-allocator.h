@@ -6,9 +6,11 @@
 #define V8_HEAP_MEMORY_ALLOCATOR_H_
 
 #include <atomic>
+#include <map>
 #include <memory>
 #include <optional>
 #include <set>
+#include <tuple>
 #include <unordered_set>
 
 #include "include/v8-platform.h"
@@ -115,6 +117,17 @@ class MemoryAllocator final {
 
   void ReleaseDelayedPages();
 
+  // Takes the non-executable large pages out of the delayed-then-released
+  // pages. The caller becomes responsible for releasing them via
+  // `ReleasePreFreedPage()`, which may happen on a background thread.
+  std::vector<LargePageMetadata*> TakeDelayedThenReleasedLargePages();
+
+  // Releases a page that was taken out of the delayed pages. Can be called
+  // concurrently.
+  void ReleasePreFreedPage(MutablePageMetadata* page) {
+    PerformFreeMemory(page);
+  }
+
   // Returns allocated spaces in bytes.
   size_t Size() const { return size_; }
 
@@ -127,6 +140,17 @@ class MemoryAllocator final {
     return capacity_ < size ? 0 : capacity_ - size;
   }
 
+  // Returns the bytes reserved for huge page regions (see
+  // --huge-page-regions), the part of them that currently backs pages and the
+  // part of the free page slots whose memory was discarded.
+  size_t HugePageRegionsSize() const { return huge_page_regions_.size(); }
+  size_t HugePageRegionsSizeInUse() const {
+    return huge_page_regions_.size_in_use();
+  }
+  size_t HugePageRegionsSizeDiscarded() const {
+    return huge_page_regions_.size_discarded();
+  }
+
   // Returns an indication of whether a pointer is in a space that has
   // been allocated by this MemoryAllocator. It is conservative, allowing
   // false negatives (i.e., if a pointer is outside the allocated space, it may
@@ -232,6 +256,78 @@ class MemoryAllocator final {
 #endif  // DEBUG
 
  private:
+  // Packs regular pages into regions of kRegionSize that are aligned to their
+  // size and advised to be backed by transparent huge pages. A region is only
+  // returned to the OS once all of its pages have been freed; pages freed
+  // before that keep their memory committed for reuse until
+  // DiscardFreePages() is called.
+  class HugePageRegions final {
+   public:
+    static constexpr size_t kRegionSize = size_t{2} * MB;
+    static constexpr size_t kPagesPerRegion = kRegionSize / kRegularPageSize;
+    static_assert(kPagesPerRegion <= kBitsPerByte * sizeof(uint32_t));
+
+    // Returns whether pages of the given space are placed in huge page
+    // regions.
+    static bool IsEnabledFor(AllocationSpace space, Executability executable);
+
+    HugePageRegions() = default;
+    HugePageRegions(const HugePageRegions&) = delete;
+    HugePageRegions& operator=(const HugePageRegions&) = delete;
+
+    // Returns the start of a free page slot in a region reserved from
+    // |page_allocator|, reserving a new region if needed. Returns kNullAddress
+    // on failure.
+    Address AllocatePage(v8::PageAllocator* page_allocator);
+
+    // Returns the page slot at |page| to its region and releases the region
+    // once it is empty.
+    void FreePage(Address page);
+
+    // Discards the memory of all free page slots, e.g. on memory-reducing
+    // GCs. This splits the huge pages backing the affected regions.
+    void DiscardFreePages();
+
+    bool Contains(Address address) const;
+
+    // Releases all regions. All pages must have been freed before.
+    void TearDown();
+
+    size_t size() const { return size_.load(std::memory_order_relaxed); }
+    size_t size_in_use() const {
+      return size_in_use_.load(std::memory_order_relaxed);
+    }
+    size_t size_discarded() const {
+      return size_discarded_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    struct Region {
+      VirtualMemory reservation;
+      // Bit i is set if the i-th page slot of the region is in use.
+      uint32_t used_slots = 0;
+      // Bit i is set if the i-th page slot is free and its memory was
+      // discarded.
+      uint32_t discarded_slots = 0;
+    };
+
+    // Regions with free slots, ordered by page allocator and then by the
+    // number of free slots, so that the fullest region of a page allocator is
+    // found without scanning all regions.
+    using PartialRegionKey = std::tuple<v8::PageAllocator*, size_t, Address>;
+
+    static PartialRegionKey GetPartialRegionKey(Address start,
+                                                const Region& region);
+
+    mutable base::Mutex mutex_;
+    // Regions keyed by their start address.
+    std::map<Address, Region> regions_;
+    std::set<PartialRegionKey> partial_regions_;
+    std::atomic<size_t> size_{0};
+    std::atomic<size_t> size_in_use_{0};
+    std::atomic<size_t> size_discarded_{0};
+  };
+
   // Used to store all data about MemoryChunk allocation, e.g. in
   // AllocateUninitializedChunk.
   struct MemoryChunkAllocationResult {
@@ -300,6 +396,9 @@ class MemoryAllocator final {
   std::optional<MemoryChunkAllocationResult>
   TryAllocateUninitializedLargePageFromPool(Space* space, size_t chunk_size);
 
+  std::optional<MemoryChunkAllocationResult>
+  AllocateUninitializedPageFromHugePageRegion(Space* space);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
@@ -374,6 +473,7 @@ class MemoryAllocator final {
 
   std::optional<VirtualMemory> reserved_chunk_at_virtual_memory_limit_;
   MemoryPool* pool_;
+  HugePageRegions huge_page_regions_;
 
 #ifdef DEBUG
   // Data structure to remember allocated executable memory chunks.
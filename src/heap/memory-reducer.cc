@@ -4,10 +4,14 @@
 
 #include "src/heap/memory-reducer.h"
 
+#include <algorithm>
+
 #include "src/flags/flags.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/memory-pool.h"
+#include "src/init/isolate-group.h"
 #include "src/init/v8.h"
 #include "src/utils/utils.h"
 
@@ -22,12 +26,17 @@ const size_t MemoryReducer::kCommittedMemoryDelta = 10 * MB;
 
 MemoryReducer::MemoryReducer(Heap* heap)
     : heap_(heap),
+      group_memory_reducer_(
+          v8_flags.group_memory_reducer
+              ? heap->isolate()->isolate_group()->group_memory_reducer()
+              : nullptr),
       taskrunner_(heap->GetForegroundTaskRunner()),
       state_(State::CreateUninitialized()),
       js_calls_counter_(0),
       js_calls_sample_time_ms_(0.0) {
   DCHECK(v8_flags.incremental_marking);
   DCHECK(v8_flags.memory_reducer);
+  if (group_memory_reducer_) group_memory_reducer_->AddHeap(heap);
 }
 
 MemoryReducer::TimerTask::TimerTask(MemoryReducer* memory_reducer)
@@ -76,6 +85,7 @@ void MemoryReducer::NotifyTimer(const Event& event) {
   if (state_.id() != kWait) return;
   DCHECK_EQ(kTimer, event.type);
   state_ = Step(state_, event);
+  if (state_.id() == kDone) NotifyGroupMemoryReducer();
   if (state_.id() == kRun) {
     DCHECK(heap()->incremental_marking()->IsStopped());
     DCHECK(v8_flags.incremental_marking);
@@ -122,6 +132,7 @@ void MemoryReducer::NotifyMarkCompact(size_t committed_memory_before) {
     // If we are transitioning to the WAIT state, start the timer.
     ScheduleTimer(state_.next_gc_start_ms() - event.time_ms);
   }
+  NotifyGroupMemoryReducer();
   if (old_state.id() == kRun && v8_flags.trace_memory_reducer) {
     heap()->isolate()->PrintWithTimestamp(
         "Memory reducer: finished GC #%d (%s)\n", old_state.started_gcs(),
@@ -143,9 +154,16 @@ void MemoryReducer::NotifyPossibleGarbage() {
   if (old_action != kWait && state_.id() == kWait) {
     // If we are transitioning to the WAIT state, start the timer.
     ScheduleTimer(state_.next_gc_start_ms() - event.time_ms);
+    if (old_action == kDone) NotifyGroupMemoryReducer();
   }
 }
 
+void MemoryReducer::NotifyGroupMemoryReducer() {
+  if (!group_memory_reducer_) return;
+  group_memory_reducer_->NotifyHeapState(heap(), heap()->CommittedMemory(),
+                                         state_.id() == kDone);
+}
+
 bool MemoryReducer::WatchdogGC(const State& state, const Event& event) {
   return state.last_gc_time_ms() != 0 &&
          event.time_ms > state.last_gc_time_ms() + kWatchdogDelayMs;
@@ -234,7 +252,10 @@ void MemoryReducer::ScheduleTimer(double delay_ms) {
                                (delay_ms + kSlackMs) / 1000.0);
 }
 
-void MemoryReducer::TearDown() { state_ = State::CreateUninitialized(); }
+void MemoryReducer::TearDown() {
+  if (group_memory_reducer_) group_memory_reducer_->RemoveHeap(heap());
+  state_ = State::CreateUninitialized();
+}
 
 // static
 int MemoryReducer::MaxNumberOfGCs() {
@@ -248,5 +269,131 @@ bool MemoryReducer::IsFrozen(const Heap* heap) {
          heap->isolate()->IsFrozen();
 }
 
+class GroupMemoryReducer::ReduceMemoryTask final : public CancelableTask {
+ public:
+  explicit ReduceMemoryTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  ReduceMemoryTask(const ReduceMemoryTask&) = delete;
+  ReduceMemoryTask& operator=(const ReduceMemoryTask&) = delete;
+
+ private:
+  void RunInternal() override {
+    SetCurrentIsolateScope isolate_scope(heap_->isolate());
+    if (v8_flags.trace_memory_reducer) {
+      heap_->isolate()->PrintWithTimestamp(
+          "Group memory reducer: reducing idle isolate\n");
+    }
+    // The isolate is idle, so a non-incremental GC does not get in the way of
+    // the mutator.
+    heap_->CollectAllGarbage(GCFlag::kReduceMemoryFootprint,
+                             GarbageCollectionReason::kMemoryReducer);
+  }
+
+  Heap* const heap_;
+};
+
+GroupMemoryReducer::~GroupMemoryReducer() { DCHECK(heaps_.empty()); }
+
+void GroupMemoryReducer::AddHeap(Heap* heap) {
+  base::MutexGuard guard(&mutex_);
+  HeapState state;
+  state.task_runner = heap->GetForegroundTaskRunner();
+  const bool inserted = heaps_.emplace(heap, std::move(state)).second;
+  CHECK(inserted);
+}
+
+void GroupMemoryReducer::RemoveHeap(Heap* heap) {
+  base::MutexGuard guard(&mutex_);
+  auto it = heaps_.find(heap);
+  CHECK_NE(it, heaps_.end());
+  committed_memory_ -= it->second.committed_memory;
+  heaps_.erase(it);
+}
+
+void GroupMemoryReducer::NotifyHeapState(Heap* heap, size_t committed_memory,
+                                         bool is_idle) {
+  const size_t budget = v8_flags.group_memory_reducer_budget * MB;
+  bool became_idle = false;
+  bool over_budget = false;
+  size_t heaps_to_reduce = 0;
+  size_t group_committed_memory;
+  {
+    base::MutexGuard guard(&mutex_);
+    auto it = heaps_.find(heap);
+    CHECK_NE(it, heaps_.end());
+    HeapState& state = it->second;
+    committed_memory_ = committed_memory_ - state.committed_memory +
+                        committed_memory;
+    state.committed_memory = committed_memory;
+    became_idle = is_idle && !state.is_idle;
+    if (!is_idle) state.reduction_requested = false;
+    state.is_idle = is_idle;
+    group_committed_memory = committed_memory_;
+
+    over_budget = budget > 0 && committed_memory_ > budget;
+    if (over_budget) {
+      std::vector<Candidate> candidates;
+      for (const auto& [candidate, candidate_state] : heaps_) {
+        if (candidate_state.is_idle && !candidate_state.reduction_requested) {
+          candidates.push_back({candidate, candidate_state.committed_memory});
+        }
+      }
+      // Tasks are posted while holding the mutex, so that the target heaps
+      // cannot be torn down in the meantime.
+      for (Heap* target :
+           SelectHeapsToReduce(std::move(candidates), committed_memory_,
+                               budget)) {
+        HeapState& target_state = heaps_.find(target)->second;
+        target_state.reduction_requested = true;
+        target_state.task_runner->PostTask(
+            std::make_unique<ReduceMemoryTask>(target));
+        heaps_to_reduce++;
+      }
+    }
+  }
+
+  if (memory_pool_) {
+    if (over_budget) {
+      memory_pool_->ReleaseAllImmediately();
+    } else if (became_idle) {
+      memory_pool_->ReleaseImmediately(heap->isolate());
+    }
+  }
+
+  if (v8_flags.trace_memory_reducer && (over_budget || became_idle)) {
+    heap->isolate()->PrintWithTimestamp(
+        "Group memory reducer: %zuMB committed, budget %zuMB, %s, reducing %zu "
+        "idle isolates\n",
+        group_committed_memory / MB, budget / MB,
+        is_idle ? "idle" : "active", heaps_to_reduce);
+  }
+}
+
+size_t GroupMemoryReducer::CommittedMemory() const {
+  base::MutexGuard guard(&mutex_);
+  return committed_memory_;
+}
+
+// static
+std::vector<Heap*> GroupMemoryReducer::SelectHeapsToReduce(
+    std::vector<Candidate> candidates, size_t committed_memory,
+    size_t budget) {
+  std::vector<Heap*> result;
+  if (committed_memory <= budget) return result;
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Candidate& a, const Candidate& b) {
+              return a.committed_memory > b.committed_memory;
+            });
+  const size_t excess = committed_memory - budget;
+  size_t reducible = 0;
+  for (const Candidate& candidate : candidates) {
+    if (reducible >= excess) break;
+    result.push_back(candidate.heap);
+    reducible += candidate.committed_memory;
+  }
+  return result;
+}
+
 }  // namespace internal
 }  // namespace v8
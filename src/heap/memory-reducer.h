@@ -5,8 +5,13 @@
 #ifndef V8_HEAP_MEMORY_REDUCER_H_
 #define V8_HEAP_MEMORY_REDUCER_H_
 
+#include <memory>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 #include "src/tasks/cancelable-task.h"
 
@@ -17,8 +22,9 @@ namespace heap {
 class HeapTester;
 }  // namespace heap
 
+class GroupMemoryReducer;
 class Heap;
-
+class MemoryPool;
 
 // The goal of the MemoryReducer class is to detect transition of the mutator
 // from high allocation phase to low allocation phase and to collect potential
@@ -199,10 +205,12 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   };
 
   void NotifyTimer(const Event& event);
+  void NotifyGroupMemoryReducer();
 
   static bool WatchdogGC(const State& state, const Event& event);
 
   Heap* heap_;
+  GroupMemoryReducer* const group_memory_reducer_;
   std::shared_ptr<v8::TaskRunner> taskrunner_;
   State state_;
   unsigned int js_calls_counter_;
@@ -213,6 +221,66 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   friend class heap::HeapTester;
 };
 
+// The GroupMemoryReducer coordinates the memory reducers of all isolates in an
+// isolate group (--group-memory-reducer). With many mostly idle isolates per
+// process, the per-isolate heuristics let every idle isolate keep its
+// committed and pooled pages. Instead, the group reducer
+// - tracks the committed memory of all heaps in the group, as reported by
+//   their memory reducers,
+// - releases the pooled pages of an isolate once its memory reducer is done,
+// - and, when the group exceeds --group-memory-reducer-budget, releases all
+//   pooled pages and asks the idle isolates with the most committed memory
+//   for a GC with kReduceMemoryFootprint, which compacts the old generation
+//   and shrinks the new space. Every isolate is asked at most once per idle
+//   period.
+class V8_EXPORT_PRIVATE GroupMemoryReducer final {
+ public:
+  struct Candidate {
+    Heap* heap;
+    size_t committed_memory;
+  };
+
+  explicit GroupMemoryReducer(MemoryPool* memory_pool)
+      : memory_pool_(memory_pool) {}
+  ~GroupMemoryReducer();
+  GroupMemoryReducer(const GroupMemoryReducer&) = delete;
+  GroupMemoryReducer& operator=(const GroupMemoryReducer&) = delete;
+
+  // Called on the heap's thread when its memory reducer is set up and torn
+  // down.
+  void AddHeap(Heap* heap);
+  void RemoveHeap(Heap* heap);
+
+  // Called on the heap's thread whenever its memory reducer changes state. A
+  // heap is idle while its memory reducer is done.
+  void NotifyHeapState(Heap* heap, size_t committed_memory, bool is_idle);
+
+  // Committed memory of all heaps in the group, as last reported.
+  size_t CommittedMemory() const;
+
+  // Returns the candidates with the most committed memory, until reducing them
+  // could bring `committed_memory` down to `budget`.
+  static std::vector<Heap*> SelectHeapsToReduce(
+      std::vector<Candidate> candidates, size_t committed_memory,
+      size_t budget);
+
+ private:
+  class ReduceMemoryTask;
+
+  struct HeapState {
+    std::shared_ptr<v8::TaskRunner> task_runner;
+    size_t committed_memory = 0;
+    bool is_idle = false;
+    // Whether a memory-reducing GC was requested in the current idle period.
+    bool reduction_requested = false;
+  };
+
+  MemoryPool* const memory_pool_;
+  mutable base::Mutex mutex_;
+  absl::flat_hash_map<Heap*, HeapState> heaps_;
+  size_t committed_memory_ = 0;
+};
+
 }  // namespace internal
 }  // namespace v8
 
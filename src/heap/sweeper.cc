@@ -173,6 +173,7 @@ class Sweeper::MajorSweeperJob final : public JobTask {
       DCHECK_NE(NEW_SPACE, space_id);
       if (!concurrent_sweeper.ConcurrentSweepSpace(space_id, delegate)) return;
     }
+    sweeper_->ReleaseLargePages(delegate);
   }
 
   Sweeper* const sweeper_;
@@ -691,6 +692,7 @@ Sweeper::~Sweeper() = default;
 void Sweeper::TearDown() {
   minor_sweeping_state_.StopConcurrentSweeping();
   major_sweeping_state_.StopConcurrentSweeping();
+  ReleaseLargePages(nullptr);
 }
 
 void Sweeper::InitializeMajorSweeping() {
@@ -874,12 +876,14 @@ void Sweeper::FinishMajorJobs() {
       main_thread_local_sweeper_.ParallelSweepSpace(
           space, SweepingMode::kLazyOrConcurrent);
     });
+    ReleaseLargePages(nullptr);
   }
 
   // Join all concurrent tasks.
   major_sweeping_state_.JoinSweeping();
   // All jobs are done but we still remain in sweeping state here.
   DCHECK(major_sweeping_in_progress());
+  DCHECK(large_pages_for_release_.empty());
 
   ForAllSweepingSpaces([this](AllocationSpace space) {
     if (space == NEW_SPACE) return;
@@ -1286,7 +1290,7 @@ size_t Sweeper::ConcurrentMinorSweepingPageCount() {
 size_t Sweeper::ConcurrentMajorSweepingPageCount() {
   DCHECK(major_sweeping_in_progress());
   base::MutexGuard guard(&mutex_);
-  size_t count = 0;
+  size_t count = large_pages_for_release_.size();
   for (int i = 0; i < kNumberOfSweepingSpaces; i++) {
     if (i == GetSweepSpaceIndex(NEW_SPACE)) continue;
     count += sweeping_list_[i].size();
@@ -1294,6 +1298,54 @@ size_t Sweeper::ConcurrentMajorSweepingPageCount() {
   return count;
 }
 
+void Sweeper::AddLargePagesForRelease(std::vector<LargePageMetadata*> pages) {
+  DCHECK(major_sweeping_in_progress());
+  if (pages.empty()) return;
+  size_t bytes = 0;
+  for (LargePageMetadata* page : pages) {
+    DCHECK(page->is_pre_freed());
+    DCHECK(!page->is_executable());
+    bytes += page->size();
+  }
+  // Keep the pending bytes bounded: under memory pressure, or when the
+  // sweeper tasks fall behind, the pages are released right away.
+  const bool release_concurrently =
+      v8_flags.concurrent_sweeping && heap_->ShouldUseBackgroundThreads() &&
+      !heap_->ShouldReduceMemory() && !heap_->HighMemoryPressure() &&
+      PendingLargePageReleaseBytes() + bytes <=
+          v8_flags.max_pending_large_page_release * MB;
+  if (!release_concurrently) {
+    for (LargePageMetadata* page : pages) {
+      heap_->memory_allocator()->ReleasePreFreedPage(page);
+    }
+    return;
+  }
+  // Account the bytes before publishing the pages so that concurrent releasing
+  // never decrements below zero.
+  pending_large_page_release_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  base::MutexGuard guard(&mutex_);
+  large_pages_for_release_.insert(large_pages_for_release_.end(),
+                                  pages.begin(), pages.end());
+}
+
+bool Sweeper::ReleaseLargePages(JobDelegate* delegate) {
+  MemoryAllocator* allocator = heap_->memory_allocator();
+  while (!delegate || !delegate->ShouldYield()) {
+    LargePageMetadata* page;
+    {
+      base::MutexGuard guard(&mutex_);
+      if (large_pages_for_release_.empty()) return true;
+      page = large_pages_for_release_.back();
+      large_pages_for_release_.pop_back();
+    }
+    const size_t size = page->size();
+    allocator->ReleasePreFreedPage(page);
+    pending_large_page_release_bytes_.fetch_sub(size,
+                                                std::memory_order_relaxed);
+  }
+  return false;
+}
+
 bool Sweeper::ParallelSweepSpace(AllocationSpace identity,
                                  SweepingMode sweeping_mode,
                                  uint32_t max_pages) {
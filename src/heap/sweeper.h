@@ -125,6 +125,15 @@ class Sweeper {
   void AddNewSpacePage(PageMetadata* page);
   void AddPromotedPage(MutablePageMetadata* chunk);
 
+  // Hands dead large pages, which have already been pre-freed by the memory
+  // allocator, to the major sweeper tasks for releasing. Pages are released
+  // right away instead when reducing memory or when too many bytes are already
+  // pending release.
+  void AddLargePagesForRelease(std::vector<LargePageMetadata*> pages);
+  size_t PendingLargePageReleaseBytes() const {
+    return pending_large_page_release_bytes_.load(std::memory_order_relaxed);
+  }
+
   // Returns true if any swept pages can be allocated on.
   bool ParallelSweepSpace(
       AllocationSpace identity, SweepingMode sweeping_mode,
@@ -248,6 +257,10 @@ class Sweeper {
   size_t ConcurrentMinorSweepingPageCount();
   size_t ConcurrentMajorSweepingPageCount();
 
+  // Releases large pages added via `AddLargePagesForRelease()`. Returns true
+  // if all pages were released and false if the delegate requested to yield.
+  bool ReleaseLargePages(JobDelegate* delegate);
+
   PageMetadata* GetSweepingPageSafe(AllocationSpace space);
   MutablePageMetadata* GetPromotedPageSafe();
   bool TryRemoveSweepingPageSafe(AllocationSpace space, PageMetadata* page);
@@ -327,6 +340,8 @@ class Sweeper {
   std::atomic<bool> has_sweeping_work_[kNumberOfSweepingSpaces]{false};
   std::atomic<bool> has_swept_pages_[kNumberOfSweepingSpaces]{false};
   std::vector<MutablePageMetadata*> sweeping_list_for_promoted_page_iteration_;
+  std::vector<LargePageMetadata*> large_pages_for_release_;
+  std::atomic<size_t> pending_large_page_release_bytes_{0};
   LocalSweeper main_thread_local_sweeper_;
   SweepingState<SweepingScope::kMajor> major_sweeping_state_{this};
   SweepingState<SweepingScope::kMinor> minor_sweeping_state_{this};
@@ -15,6 +15,7 @@
 #include "src/execution/isolate.h"
 #include "src/heap/code-range.h"
 #include "src/heap/memory-pool.h"
+#include "src/heap/memory-reducer.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/read-only-spaces.h"
 #include "src/sandbox/code-pointer-table-inl.h"
@@ -213,6 +214,8 @@ void IsolateGroup::Initialize(bool process_wide, Sandbox* sandbox) {
   if (v8_flags.memory_pool) {
     memory_pool_ = std::make_unique<MemoryPool>();
   }
+  group_memory_reducer_ =
+      std::make_unique<GroupMemoryReducer>(memory_pool_.get());
 
 #ifdef V8_ENABLE_LEAPTIERING
   js_dispatch_table()->Initialize();
@@ -256,6 +259,8 @@ void IsolateGroup::Initialize(bool process_wide) {
   optimizing_compile_task_executor_ =
       std::make_unique<OptimizingCompileTaskExecutor>();
   memory_pool_ = std::make_unique<MemoryPool>();
+  group_memory_reducer_ =
+      std::make_unique<GroupMemoryReducer>(memory_pool_.get());
 #ifdef V8_ENABLE_LEAPTIERING
   js_dispatch_table()->Initialize();
 #endif  // V8_ENABLE_LEAPTIERING
@@ -267,6 +272,8 @@ void IsolateGroup::Initialize(bool process_wide) {
   optimizing_compile_task_executor_ =
       std::make_unique<OptimizingCompileTaskExecutor>();
   memory_pool_ = std::make_unique<MemoryPool>();
+  group_memory_reducer_ =
+      std::make_unique<GroupMemoryReducer>(memory_pool_.get());
 #ifdef V8_ENABLE_LEAPTIERING
   js_dispatch_table()->Initialize();
 #endif  // V8_ENABLE_LEAPTIERING
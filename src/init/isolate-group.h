@@ -39,6 +39,7 @@ class LeakyObject;
 
 namespace internal {
 
+class GroupMemoryReducer;
 class MemoryPool;
 
 #ifdef V8_ENABLE_SANDBOX
@@ -316,6 +317,10 @@ class V8_EXPORT_PRIVATE IsolateGroup final {
 
   MemoryPool* memory_pool() const { return memory_pool_.get(); }
 
+  GroupMemoryReducer* group_memory_reducer() const {
+    return group_memory_reducer_.get();
+  }
+
   template <typename Callback>
   bool FindAnotherIsolateLocked(Isolate* isolate, Callback callback) {
     // Holding this mutex while invoking the callback avoids the isolate tearing
@@ -389,6 +394,8 @@ class V8_EXPORT_PRIVATE IsolateGroup final {
 #endif  // V8_COMPRESS_POINTERS_IN_MULTIPLE_CAGES
 
   std::unique_ptr<MemoryPool> memory_pool_;
+  // Declared after `memory_pool_`, which it releases pages from.
+  std::unique_ptr<GroupMemoryReducer> group_memory_reducer_;
 
   base::OnceType init_code_range_ = V8_ONCE_INIT;
   std::unique_ptr<CodeRange> code_range_;
@@ -0,0 +1,350 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-incremental-parser.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/js-objects-inl.h"
+#include "src/objects/lookup.h"
+#include "src/objects/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+bool IsJsonWhitespace(uint8_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+}  // namespace
+
+JsonIncrementalParser::JsonIncrementalParser(Isolate* isolate)
+    : isolate_(isolate) {
+  stack_ = isolate_->global_handles()->Create(
+      *isolate_->factory()->NewFixedArray(8));
+}
+
+JsonIncrementalParser::~JsonIncrementalParser() {
+  GlobalHandles::Destroy(stack_.location());
+  if (!result_.is_null()) GlobalHandles::Destroy(result_.location());
+}
+
+void JsonIncrementalParser::Append(base::Vector<const uint8_t> json_utf8) {
+  DCHECK(!finished_);
+  // Drop the parsed input once it makes up most of the buffer.
+  if (position_ > buffer_.size() / 2) {
+    buffer_.erase(buffer_.begin(), buffer_.begin() + position_);
+    consumed_ += position_;
+    position_ = 0;
+  }
+  buffer_.insert(buffer_.end(), json_utf8.begin(), json_utf8.end());
+}
+
+void JsonIncrementalParser::Finish() { finished_ = true; }
+
+DirectHandle<Object> JsonIncrementalParser::result() const {
+  DCHECK(!result_.is_null());
+  return result_;
+}
+
+Maybe<JsonIncrementalParser::Status> JsonIncrementalParser::Parse(
+    base::TimeDelta time_budget, size_t byte_budget) {
+  DCHECK(!failed_);
+  base::ElapsedTimer timer;
+  timer.Start();
+  const size_t start = consumed_ + position_;
+  while (true) {
+    SkipWhitespace();
+    if (state_ == State::kEnd) {
+      if (available() > 0) {
+        ThrowSyntaxError(
+            MessageTemplate::kJsonParseUnexpectedNonWhiteSpaceCharacter);
+        return Nothing<Status>();
+      }
+      return Just(finished_ ? Status::kDone : Status::kNeedsInput);
+    }
+    if (available() == 0) {
+      if (!finished_) return Just(Status::kNeedsInput);
+      ThrowSyntaxError(MessageTemplate::kJsonParseUnexpectedEOS);
+      return Nothing<Status>();
+    }
+    switch (Step()) {
+      case StepResult::kProgress:
+        break;
+      case StepResult::kNeedsInput:
+        DCHECK(!finished_);
+        return Just(Status::kNeedsInput);
+      case StepResult::kException:
+        failed_ = true;
+        return Nothing<Status>();
+    }
+    if (state_ != State::kEnd &&
+        (consumed_ + position_ - start >= byte_budget ||
+         timer.Elapsed() >= time_budget)) {
+      return Just(Status::kYielded);
+    }
+  }
+}
+
+JsonIncrementalParser::StepResult JsonIncrementalParser::Step() {
+  HandleScope scope(isolate_);
+  uint8_t c = *cursor();
+  switch (state_) {
+    case State::kArrayFirstValue:
+      if (c == ']') {
+        Advance(1);
+        return CloseContainer();
+      }
+      return ParseValue();
+    case State::kValue:
+      return ParseValue();
+    case State::kArrayNext:
+      if (c == ',') {
+        Advance(1);
+        state_ = State::kValue;
+        return StepResult::kProgress;
+      }
+      if (c == ']') {
+        Advance(1);
+        return CloseContainer();
+      }
+      return ThrowSyntaxError(MessageTemplate::kJsonParseExpectedCommaOrRBrack);
+    case State::kObjectFirstKey:
+      if (c == '}') {
+        Advance(1);
+        return CloseContainer();
+      }
+      if (c != '"') {
+        return ThrowSyntaxError(
+            MessageTemplate::kJsonParseExpectedPropNameOrRBrace);
+      }
+      return ParseKey();
+    case State::kObjectKey:
+      if (c != '"') {
+        return ThrowSyntaxError(
+            MessageTemplate::kJsonParseExpectedDoubleQuotedPropertyName);
+      }
+      return ParseKey();
+    case State::kObjectColon:
+      if (c != ':') {
+        return ThrowSyntaxError(
+            MessageTemplate::kJsonParseExpectedColonAfterPropertyName);
+      }
+      Advance(1);
+      state_ = State::kValue;
+      return StepResult::kProgress;
+    case State::kObjectNext:
+      if (c == ',') {
+        Advance(1);
+        state_ = State::kObjectKey;
+        return StepResult::kProgress;
+      }
+      if (c == '}') {
+        Advance(1);
+        return CloseContainer();
+      }
+      return ThrowSyntaxError(MessageTemplate::kJsonParseExpectedCommaOrRBrace);
+    case State::kEnd:
+      UNREACHABLE();
+  }
+}
+
+JsonIncrementalParser::StepResult JsonIncrementalParser::ParseValue() {
+  uint8_t c = *cursor();
+  bool is_container = c == '{' || c == '[';
+  size_t limit = is_container
+                     ? position_ + std::min(available(), kMaxWholeValueLength)
+                     : buffer_.size();
+  size_t end = FindValueEnd(limit);
+  if (end == kNotFound) {
+    // Build up objects and arrays that are too long or incomplete, so that
+    // the error for truncated input points at where it ends.
+    if (is_container && (available() >= kMaxWholeValueLength || finished_)) {
+      return OpenContainer(c == '[');
+    }
+    if (!finished_) return StepResult::kNeedsInput;
+    // Let JsonParser report what is wrong with the rest of the input.
+    end = buffer_.size();
+  }
+  if (end == position_) {
+    // Not the start of a value, e.g. ']' after ','. Let JsonParser report the
+    // unexpected character.
+    end = position_ + 1;
+  }
+  DirectHandle<Object> value;
+  if (!ParseWhole(end).ToHandle(&value)) return StepResult::kException;
+  return AddValue(value);
+}
+
+JsonIncrementalParser::StepResult JsonIncrementalParser::ParseKey() {
+  DCHECK_EQ(*cursor(), '"');
+  size_t end = FindValueEnd(buffer_.size());
+  if (end == kNotFound) {
+    if (!finished_) return StepResult::kNeedsInput;
+    end = buffer_.size();
+  }
+  DirectHandle<Object> key;
+  if (!ParseWhole(end).ToHandle(&key)) return StepResult::kException;
+  DCHECK(IsString(*key));
+  key = isolate_->factory()->InternalizeString(Cast<String>(key));
+  stack_->set(static_cast<int>(2 * frames_.size() - 1), *key);
+  state_ = State::kObjectColon;
+  return StepResult::kProgress;
+}
+
+JsonIncrementalParser::StepResult JsonIncrementalParser::OpenContainer(
+    bool is_array) {
+  Advance(1);
+  Factory* factory = isolate_->factory();
+  DirectHandle<JSObject> container;
+  if (is_array) {
+    container = factory->NewJSArray(0);
+  } else {
+    container = factory->NewJSObject(isolate_->object_function());
+  }
+  int index = static_cast<int>(2 * frames_.size());
+  if (index + 1 >= stack_->length()) {
+    Handle<FixedArray> grown = FixedArray::SetAndGrow(
+        isolate_, stack_, index + 1, factory->undefined_value());
+    GlobalHandles::Destroy(stack_.location());
+    stack_ = isolate_->global_handles()->Create(*grown);
+  }
+  stack_->set(index, *container);
+  frames_.push_back({is_array, 0});
+  state_ = is_array ? State::kArrayFirstValue : State::kObjectFirstKey;
+  return StepResult::kProgress;
+}
+
+JsonIncrementalParser::StepResult JsonIncrementalParser::CloseContainer() {
+  DCHECK(!frames_.empty());
+  int index = static_cast<int>(2 * (frames_.size() - 1));
+  DirectHandle<Object> container(stack_->get(index), isolate_);
+  stack_->set(index, ReadOnlyRoots(isolate_).undefined_value());
+  stack_->set(index + 1, ReadOnlyRoots(isolate_).undefined_value());
+  frames_.pop_back();
+  return AddValue(container);
+}
+
+JsonIncrementalParser::StepResult JsonIncrementalParser::AddValue(
+    DirectHandle<Object> value) {
+  if (frames_.empty()) {
+    result_ = isolate_->global_handles()->Create(*value);
+    state_ = State::kEnd;
+    return StepResult::kProgress;
+  }
+  Frame& frame = frames_.back();
+  int index = static_cast<int>(2 * (frames_.size() - 1));
+  DirectHandle<JSObject> container(Cast<JSObject>(stack_->get(index)),
+                                   isolate_);
+  if (frame.is_array) {
+    PropertyKey key(isolate_, static_cast<double>(frame.length++));
+    CHECK(JSObject::CreateDataProperty(isolate_, container, key, value,
+                                       Just(kThrowOnError))
+              .FromJust());
+    state_ = State::kArrayNext;
+  } else {
+    DirectHandle<Name> name(Cast<Name>(stack_->get(index + 1)), isolate_);
+    CHECK(JSObject::CreateDataProperty(isolate_, container,
+                                       PropertyKey(isolate_, name), value,
+                                       Just(kThrowOnError))
+              .FromJust());
+    state_ = State::kObjectNext;
+  }
+  return StepResult::kProgress;
+}
+
+size_t JsonIncrementalParser::FindValueEnd(size_t limit) const {
+  const uint8_t* start = cursor();
+  const uint8_t* end = buffer_.data() + limit;
+  int depth = 0;
+  bool in_string = false;
+  for (const uint8_t* it = start; it < end; it++) {
+    uint8_t c = *it;
+    if (in_string) {
+      if (c == '\\') {
+        // Skip the escaped character.
+        if (++it == end) break;
+      } else if (c == '"') {
+        in_string = false;
+        if (depth == 0) return it + 1 - buffer_.data();
+      }
+      continue;
+    }
+    switch (c) {
+      case '"':
+        in_string = true;
+        break;
+      case '[':
+      case '{':
+        depth++;
+        break;
+      case ']':
+      case '}':
+        if (depth == 0) return it - buffer_.data();
+        if (--depth == 0) return it + 1 - buffer_.data();
+        break;
+      case ',':
+      case ':':
+        if (depth == 0) return it - buffer_.data();
+        break;
+      default:
+        if (depth == 0 && IsJsonWhitespace(c)) return it - buffer_.data();
+        break;
+    }
+  }
+  return kNotFound;
+}
+
+MaybeHandle<Object> JsonIncrementalParser::ParseWhole(size_t end) {
+  DCHECK_LT(position_, end);
+  DCHECK_LE(end, buffer_.size());
+  MaybeHandle<Object> value = JsonParseUtf8(
+      isolate_,
+      base::Vector<const uint8_t>(cursor(), end - position_), std::nullopt);
+  Advance(end - position_);
+  return value;
+}
+
+JsonIncrementalParser::StepResult JsonIncrementalParser::ThrowSyntaxError(
+    MessageTemplate message) {
+  failed_ = true;
+  size_t position = consumed_ + position_;
+  Factory* factory = isolate_->factory();
+  isolate_->Throw(*factory->NewSyntaxError(
+      message, factory->NewNumberFromSize(position),
+      factory->NewNumberFromSize(line_),
+      factory->NewNumberFromSize(position - line_start_ + 1)));
+  return StepResult::kException;
+}
+
+void JsonIncrementalParser::SkipWhitespace() {
+  size_t length = 0;
+  while (length < available() && IsJsonWhitespace(cursor()[length])) length++;
+  Advance(length);
+}
+
+void JsonIncrementalParser::Advance(size_t length) {
+  DCHECK_LE(length, available());
+  const uint8_t* it = cursor();
+  const uint8_t* end = it + length;
+  while ((it = static_cast<const uint8_t*>(
+              memchr(it, '\n', end - it))) != nullptr) {
+    it++;
+    line_++;
+    line_start_ = consumed_ + (it - buffer_.data());
+  }
+  position_ += length;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,120 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_INCREMENTAL_PARSER_H_
+#define V8_JSON_JSON_INCREMENTAL_PARSER_H_
+
+#include <vector>
+
+#include "src/base/platform/time.h"
+#include "src/base/vector.h"
+#include "src/common/message-template.h"
+#include "src/handles/handles.h"
+#include "src/objects/objects.h"
+
+namespace v8 {
+namespace internal {
+
+class FixedArray;
+
+// Parses UTF-8 encoded JSON text that is appended in pieces, in steps that
+// each stay within a time and byte budget. Unlike JsonParser, which keeps its
+// partial results in HandleScopes and caches raw character pointers, all
+// state that outlives a step is kept in global handles and in the parser's
+// own input buffer, so parsing can resume in a later step.
+//
+// Values that are completely buffered and not larger than
+// kMaxWholeValueLength are parsed in one go by JsonParser. Only the objects
+// and arrays enclosing them are built up incrementally.
+class V8_EXPORT_PRIVATE JsonIncrementalParser final {
+ public:
+  enum class Status { kNeedsInput, kYielded, kDone };
+
+  // Objects and arrays with longer texts are built up incrementally.
+  static constexpr size_t kMaxWholeValueLength = 64 * KB;
+
+  explicit JsonIncrementalParser(Isolate* isolate);
+  ~JsonIncrementalParser();
+  JsonIncrementalParser(const JsonIncrementalParser&) = delete;
+  JsonIncrementalParser& operator=(const JsonIncrementalParser&) = delete;
+
+  // Appends the next piece of input. Pieces may split tokens and UTF-8
+  // sequences anywhere.
+  void Append(base::Vector<const uint8_t> json_utf8);
+  // Signals that all input was appended.
+  void Finish();
+
+  // Parses until the appended input is used up, the budget is used up or the
+  // whole text was parsed and Finish() was called. Returns Nothing if an
+  // exception was thrown, after which the parser must not be used anymore.
+  Maybe<Status> Parse(base::TimeDelta time_budget, size_t byte_budget);
+
+  bool failed() const { return failed_; }
+  DirectHandle<Object> result() const;
+
+ private:
+  // What is expected next.
+  enum class State {
+    kValue,
+    kArrayFirstValue,  // A value or ']'.
+    kArrayNext,        // ',' or ']'.
+    kObjectFirstKey,   // A key or '}'.
+    kObjectKey,
+    kObjectColon,
+    kObjectNext,  // ',' or '}'.
+    kEnd,
+  };
+
+  enum class StepResult { kProgress, kNeedsInput, kException };
+
+  struct Frame {
+    bool is_array;
+    uint32_t length;
+  };
+
+  static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+  StepResult Step();
+  StepResult ParseValue();
+  StepResult ParseKey();
+  StepResult OpenContainer(bool is_array);
+  StepResult CloseContainer();
+  StepResult AddValue(DirectHandle<Object> value);
+
+  // Returns the end of the value that starts at the current position if it
+  // ends before |limit|, or kNotFound.
+  size_t FindValueEnd(size_t limit) const;
+  // Parses the value text [position_, end) and consumes it.
+  MaybeHandle<Object> ParseWhole(size_t end);
+
+  StepResult ThrowSyntaxError(MessageTemplate message);
+  void SkipWhitespace();
+  void Advance(size_t length);
+
+  size_t available() const { return buffer_.size() - position_; }
+  const uint8_t* cursor() const { return buffer_.data() + position_; }
+
+  Isolate* const isolate_;
+  std::vector<uint8_t> buffer_;
+  // Position of the next character in buffer_.
+  size_t position_ = 0;
+  // Characters dropped from the front of buffer_, and the line and line start
+  // of the next character, for error messages.
+  size_t consumed_ = 0;
+  size_t line_ = 1;
+  size_t line_start_ = 0;
+  bool finished_ = false;
+  bool failed_ = false;
+
+  State state_ = State::kValue;
+  std::vector<Frame> frames_;
+  // For each frame, the object or array and the pending property key.
+  IndirectHandle<FixedArray> stack_;
+  IndirectHandle<Object> result_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_INCREMENTAL_PARSER_H_
@@ -6,6 +6,7 @@
 
 #include <optional>
 
+#include "hwy/highway.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
@@ -130,6 +131,85 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+constexpr bool IsJsonWhitespace(base::uc32 c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Returns the first character in [cursor, end) that may terminate a JSON
+// string ('"', '\\' or a control character), or end. For two-byte input,
+// |bits| is or'ed with a value above the Latin-1 range if any skipped character
+// is outside of it.
+template <typename Char>
+V8_INLINE const Char* FindStringTerminatorCandidate(const Char* cursor,
+                                                    const Char* end,
+                                                    base::uc32* bits) {
+  namespace hw = hwy::HWY_NAMESPACE;
+
+  hw::FixedTag<Char, 16 / sizeof(Char)> tag;
+  static constexpr size_t stride = hw::Lanes(tag);
+
+  const auto mask_0x20 = hw::Set(tag, 0x20);
+  const auto mask_0x22 = hw::Set(tag, 0x22);
+  const auto mask_0x5c = hw::Set(tag, 0x5c);
+  const auto mask_latin1 = hw::Set(tag, unibrow::Latin1::kMaxChar);
+
+  for (; cursor + (stride - 1) < end; cursor += stride) {
+    const auto input = hw::LoadU(tag, cursor);
+    const auto has_lower_than_0x20 = input < mask_0x20;
+    const auto has_0x22 = input == mask_0x22;
+    const auto has_0x5c = input == mask_0x5c;
+    const auto result = hw::Or(hw::Or(has_lower_than_0x20, has_0x22), has_0x5c);
+    // Only the characters before the terminator contribute to |bits|, so
+    // blocks that contain one are finished by the scalar loop below.
+    if (!hw::AllFalse(tag, result)) break;
+    if (sizeof(Char) == 2 && !hw::AllFalse(tag, input > mask_latin1)) {
+      *bits |= unibrow::Latin1::kMaxChar + 1;
+    }
+  }
+
+  return std::find_if(cursor, end, [bits](Char c) {
+    if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
+      *bits |= c;
+      return false;
+    }
+    return MayTerminateJsonString(character_json_scan_flags[c]);
+  });
+}
+
+// Returns the first character in [cursor, end) that is not JSON whitespace, or
+// end.
+template <typename Char>
+V8_INLINE const Char* FindNonWhitespace(const Char* cursor, const Char* end) {
+  namespace hw = hwy::HWY_NAMESPACE;
+
+  // Most tokens are preceded by no whitespace or by a single space, which is
+  // cheaper to check without going through vector registers.
+  for (int i = 0; i < 2; i++) {
+    if (cursor == end || !IsJsonWhitespace(*cursor)) return cursor;
+    cursor++;
+  }
+
+  hw::FixedTag<Char, 16 / sizeof(Char)> tag;
+  static constexpr size_t stride = hw::Lanes(tag);
+
+  const auto mask_space = hw::Set(tag, ' ');
+  const auto mask_tab = hw::Set(tag, '\t');
+  const auto mask_cr = hw::Set(tag, '\r');
+  const auto mask_lf = hw::Set(tag, '\n');
+
+  for (; cursor + (stride - 1) < end; cursor += stride) {
+    const auto input = hw::LoadU(tag, cursor);
+    const auto is_whitespace =
+        hw::Or(hw::Or(input == mask_space, input == mask_tab),
+               hw::Or(input == mask_cr, input == mask_lf));
+    if (V8_LIKELY(hw::AllTrue(tag, is_whitespace))) continue;
+    return cursor + hw::FindKnownFirstTrue(tag, hw::Not(is_whitespace));
+  }
+
+  return std::find_if(cursor, end,
+                      [](Char c) { return !IsJsonWhitespace(c); });
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -336,6 +416,30 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source,
   end_ = cursor_ + length;
 }
 
+template <typename Char>
+JsonParser<Char>::JsonParser(Isolate* isolate, base::Vector<const Char> source,
+                             std::optional<ScriptDetails> script_details)
+    : isolate_(isolate),
+      chars_may_relocate_(false),
+      object_constructor_(isolate_->object_function()),
+      script_details_(script_details) {
+  DCHECK_LE(source.size(), String::kMaxLength);
+  chars_ = source.begin();
+  cursor_ = chars_;
+  end_ = chars_ + source.size();
+}
+
+template <typename Char>
+void JsonParser<Char>::MaterializeOriginalSource() {
+  if (!original_source_.is_null()) return;
+  base::Vector<const Char> chars(chars_, end_ - chars_);
+  if constexpr (kIsOneByte) {
+    original_source_ = factory()->NewStringFromOneByte(chars).ToHandleChecked();
+  } else {
+    original_source_ = factory()->NewStringFromTwoByte(chars).ToHandleChecked();
+  }
+}
+
 template <typename Char>
 bool JsonParser<Char>::IsSpecialString() {
   // The special cases are undefined, NaN, Infinity, and {} being passed to the
@@ -468,6 +572,7 @@ void JsonParser<Char>::ReportUnexpectedToken(
 
   // Parse failed. Current character is the unexpected token.
   Factory* factory = this->factory();
+  MaterializeOriginalSource();
   int offset = IsSlicedString(*original_source_)
                    ? Cast<SlicedString>(*original_source_)->offset()
                    : 0;
@@ -532,7 +637,7 @@ JsonParser<Char>::~JsonParser() {
     Cast<SeqString>(*source_);
     isolate()->main_thread_local_heap()->RemoveGCEpilogueCallback(
         UpdatePointersCallback, this);
-  } else {
+  } else if (!source_.is_null()) {
     // Check that the string shape hasn't changed. Otherwise our GC hooks are
     // broken.
     Cast<SeqExternalString>(*source_);
@@ -575,16 +680,8 @@ JsonToken GetTokenForCharacter(Char c) {
 
 template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
-  JsonToken local_next = JsonToken::EOS;
-
-  cursor_ = std::find_if(cursor_, end_, [&](Char c) {
-    JsonToken current = GetTokenForCharacter(c);
-    bool result = current != JsonToken::WHITESPACE;
-    if (V8_LIKELY(result)) local_next = current;
-    return result;
-  });
-
-  next_ = local_next;
+  cursor_ = FindNonWhitespace(cursor_, end_);
+  next_ = is_at_end() ? JsonToken::EOS : GetTokenForCharacter(*cursor_);
 }
 
 template <typename Char>
@@ -1451,6 +1548,7 @@ bool JsonParser<Char>::ParseRawJson() {
 template <typename Char>
 V8_INLINE MaybeHandle<Object> JsonParser<Char>::ParseJsonValueRecursive(
     Handle<Map> feedback) {
+  if (V8_UNLIKELY(!HandleInterrupts())) return {};
   SkipWhitespace();
   switch (peek()) {
     case JsonToken::NUMBER:
@@ -1697,6 +1795,9 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonObject(Handle<Map> feedback) {
 
   JsonContinuation cont(isolate_, JsonContinuation::kObjectProperty,
                         property_stack_.size());
+  const bool use_shape_cache =
+      feedback.is_null() && v8_flags.json_parse_shape_cache;
+  if (use_shape_cache) feedback = LookupShapeCache();
   bool success;
   using FastIterableState = DescriptorArray::FastIterableState;
   const MessageTemplate first_token_msg =
@@ -1732,11 +1833,88 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonObject(Handle<Map> feedback) {
   }
 
   Expect(JsonToken::RBRACE, MessageTemplate::kJsonParseExpectedCommaOrRBrace);
-  Handle<Object> result = BuildJsonObject<false>(cont, feedback);
+  Handle<JSObject> result = BuildJsonObject<false>(cont, feedback);
+  if (use_shape_cache &&
+      (feedback.is_null() || result->map() != *feedback)) {
+    UpdateShapeCache(direct_handle(result->map(), isolate_));
+  }
   property_stack_.resize(cont.index);
   return cont.scope.CloseAndEscape(result);
 }
 
+template <typename Char>
+Handle<Map> JsonParser<Char>::LookupShapeCache() {
+  // Keys longer than this are rare enough in repeated documents that peeking
+  // ahead for them isn't worth it.
+  static constexpr size_t kMaxKeyLength = 64;
+  if (peek() != JsonToken::STRING) return {};
+  Tagged<Object> cache = isolate_->native_context()->json_parse_shape_cache();
+  if (!IsWeakFixedArray(cache)) return {};
+
+  DisallowGarbageCollection no_gc;
+  const Char* start = cursor_ + 1;
+  const Char* limit =
+      start + std::min(static_cast<size_t>(end_ - start), kMaxKeyLength + 1);
+  const Char* stop = std::find_if(
+      start, limit, [](Char c) { return c == '"' || c == '\\'; });
+  // Bail out on escaped, overlong, empty and array index keys. The first two
+  // would need a full scan; the last two are never the first descriptor.
+  if (stop == limit || *stop != '"' || stop == start ||
+      IsDecimalDigit(*start)) {
+    return {};
+  }
+  uint32_t length = static_cast<uint32_t>(stop - start);
+
+  Tagged<HeapObject> heap_object;
+  if (!Cast<WeakFixedArray>(cache)
+           ->get(ShapeCacheIndex(length, start[0], stop[-1]))
+           .GetHeapObjectIfWeak(&heap_object)) {
+    return {};
+  }
+  Tagged<Map> map = Cast<Map>(heap_object);
+  if (map->IsDetached(isolate_)) return {};
+  Tagged<Name> key =
+      map->instance_descriptors(isolate_)->GetKey(InternalIndex(0));
+  if (!IsString(key) ||
+      !Cast<String>(key)->IsEqualTo(base::Vector<const Char>(start, length))) {
+    return {};
+  }
+  return handle(map, isolate_);
+}
+
+template <typename Char>
+void JsonParser<Char>::UpdateShapeCache(DirectHandle<Map> map) {
+  // Don't leak cached maps into snapshots.
+  if (isolate_->serializer_enabled()) return;
+  if (map->is_dictionary_map() || map->NumberOfOwnDescriptors() == 0 ||
+      map->IsDetached(isolate_)) {
+    return;
+  }
+  int index;
+  {
+    DisallowGarbageCollection no_gc;
+    Tagged<Name> key =
+        map->instance_descriptors(isolate_)->GetKey(InternalIndex(0));
+    if (!IsString(key)) return;
+    Tagged<String> string = Cast<String>(key);
+    uint32_t length = string->length();
+    if (length == 0) return;
+    index = ShapeCacheIndex(length, string->Get(0), string->Get(length - 1));
+  }
+
+  DirectHandle<NativeContext> native_context = isolate_->native_context();
+  DirectHandle<WeakFixedArray> cache;
+  if (IsWeakFixedArray(native_context->json_parse_shape_cache())) {
+    cache = direct_handle(
+        Cast<WeakFixedArray>(native_context->json_parse_shape_cache()),
+        isolate_);
+  } else {
+    cache = factory()->NewWeakFixedArray(kShapeCacheSize, AllocationType::kOld);
+    native_context->set_json_parse_shape_cache(*cache);
+  }
+  cache->set(index, MakeWeak(*map));
+}
+
 template <typename Char>
 MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
   {
@@ -1761,6 +1939,11 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
   DCHECK_EQ(double_elements_.size(), 0);
   DCHECK_EQ(smi_elements_.size(), 0);
   while (peek() == JsonToken::NUMBER) {
+    if (V8_UNLIKELY(!HandleInterrupts())) {
+      smi_elements_.resize(0);
+      double_elements_.resize(0);
+      return {};
+    }
     double current_double;
     int current_smi;
     if (ParseJsonNumberAsDoubleOrSmi(&current_double, &current_smi)) {
@@ -1912,6 +2095,14 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
     // objects and arrays will cause the loop to continue until a first member
     // is completed.
     while (true) {
+      if (V8_UNLIKELY(!HandleInterrupts())) {
+        // Pop the continuation stack to correctly tear down handle scopes.
+        while (!cont_stack.empty()) {
+          cont = std::move(cont_stack.back());
+          cont_stack.pop_back();
+        }
+        return MaybeHandle<Object>();
+      }
       SkipWhitespace();
       // The switch is immediately followed by 'break' so we can use 'break' to
       // break out of the loop, and 'continue' to continue the loop.
@@ -2458,13 +2649,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
-    cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
-      if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
-        bits |= c;
-        return false;
-      }
-      return MayTerminateJsonString(character_json_scan_flags[c]);
-    });
+    cursor_ = FindStringTerminatorCandidate(cursor_, end_, &bits);
 
     if (V8_UNLIKELY(is_at_end())) {
       AllowGarbageCollection allow_before_exception;
@@ -2547,5 +2732,28 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
 
+MaybeHandle<Object> JsonParseUtf8(Isolate* isolate,
+                                  base::Vector<const uint8_t> json_utf8,
+                                  std::optional<ScriptDetails> script_details) {
+  if (json_utf8.size() <= String::kMaxLength &&
+      String::IsAscii(json_utf8.begin(),
+                      static_cast<uint32_t>(json_utf8.size()))) {
+    return JsonParser<uint8_t>::Parse(isolate, json_utf8, script_details);
+  }
+  Handle<String> source;
+  if (!isolate->factory()
+           ->NewStringFromUtf8(base::Vector<const char>::cast(json_utf8))
+           .ToHandle(&source)) {
+    return {};
+  }
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  if (source->IsOneByteRepresentation()) {
+    return JsonParser<uint8_t>::Parse(isolate, source, undefined,
+                                      script_details);
+  }
+  return JsonParser<uint16_t>::Parse(isolate, source, undefined,
+                                     script_details);
+}
+
 }  // namespace internal
 }  // namespace v8
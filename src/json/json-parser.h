@@ -183,6 +183,18 @@ class JsonParser final {
     return result;
   }
 
+  // Parses |source| in place, without copying it into a String first. The
+  // characters must stay alive and unchanged until Parse returns. A String
+  // copy of the source is only created to report a syntax error.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> Parse(
+      Isolate* isolate, base::Vector<const Char> source,
+      std::optional<ScriptDetails> script_details) {
+    HighAllocationThroughputScope high_throughput_scope(
+        V8::GetCurrentPlatform());
+    JsonParser parser(isolate, source, script_details);
+    return parser.ParseJson(isolate->factory()->undefined_value());
+  }
+
   static constexpr base::uc32 kEndOfString = static_cast<base::uc32>(-1);
   static constexpr base::uc32 kInvalidUnicodeCharacter =
       static_cast<base::uc32>(-1);
@@ -214,13 +226,30 @@ class JsonParser final {
 
   JsonParser(Isolate* isolate, Handle<String> source,
              std::optional<ScriptDetails> script_details);
+  JsonParser(Isolate* isolate, base::Vector<const Char> source,
+             std::optional<ScriptDetails> script_details);
   ~JsonParser();
 
+  // Creates original_source_ for error reporting if the parser runs directly
+  // over off-heap characters.
+  void MaterializeOriginalSource();
+
   // Parse a string containing a single JSON value.
   MaybeHandle<Object> ParseJson(DirectHandle<Object> reviver);
 
   bool ParseRawJson();
 
+  // Services interrupts requested while parsing, e.g. through
+  // Isolate::RequestInterrupt or TerminateExecution, so that parsing a large
+  // input doesn't hold them off until the end. Returns false if handling them
+  // threw, in which case parsing has to stop.
+  V8_INLINE bool HandleInterrupts() {
+    StackLimitCheck interrupt_check(isolate_);
+    return V8_LIKELY(!interrupt_check.InterruptRequested()) ||
+           !IsExceptionHole(isolate_->stack_guard()->HandleInterrupts(),
+                            isolate_);
+  }
+
   void advance() { ++cursor_; }
 
   base::uc32 CurrentCharacter() {
@@ -340,6 +369,19 @@ class JsonParser final {
       Handle<Map> feedback = {});
   MaybeHandle<Object> ParseJsonArray();
   MaybeHandle<Object> ParseJsonObject(Handle<Map> feedback);
+
+  // The shape cache maps the first property key of an object literal to the
+  // final map of the last object parsed with that key in this native
+  // context. The map is used as feedback for objects that don't have sibling
+  // feedback; ParseJsonObjectProperties and JSDataObjectBuilder verify the
+  // remaining keys and fall back to regular transitions on a mismatch.
+  static constexpr int kShapeCacheSize = 64;
+  static int ShapeCacheIndex(uint32_t length, uint16_t first, uint16_t last) {
+    return static_cast<int>((length * 31 + first * 7 + last) &
+                            (kShapeCacheSize - 1));
+  }
+  Handle<Map> LookupShapeCache();
+  void UpdateShapeCache(DirectHandle<Map> map);
   template <DescriptorArray::FastIterableState fast_iterable_state>
   V8_INLINE bool ParseJsonObjectProperties(JsonContinuation* cont,
                                            MessageTemplate first_token_msg,
@@ -420,7 +462,9 @@ class JsonParser final {
   // Indicates whether the bytes underneath source_ can relocate during GC.
   bool chars_may_relocate_;
   Handle<JSFunction> object_constructor_;
-  const Handle<String> original_source_;
+  // Both are null while parsing off-heap characters, until an error is
+  // reported.
+  Handle<String> original_source_;
   Handle<String> source_;
   // Script details for error reporting. When provided, error Script
   // objects will use this information instead of inferring from the
@@ -449,6 +493,12 @@ class JsonParser final {
 extern template class JsonParser<uint8_t>;
 extern template class JsonParser<uint16_t>;
 
+// Parses UTF-8 encoded JSON text. ASCII text is parsed in place, anything else
+// is decoded into a String first.
+V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonParseUtf8(
+    Isolate* isolate, base::Vector<const uint8_t> json_utf8,
+    std::optional<ScriptDetails> script_details);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -5,9 +5,11 @@
 #include "src/json/json-stringifier.h"
 
 #include <string_view>
+#include <vector>
 
 #include "absl/functional/overload.h"
 #include "hwy/highway.h"
+#include "include/v8-profiler.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -25,12 +27,106 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
 
 static constexpr char kJsonStringifierZoneName[] = "json-stringifier-zone";
 
+// Encodes stringifier output as UTF-8 and hands it to an embedder-provided
+// OutputStream in chunks of the stream's preferred size. Writing only buffers
+// the encoded output, so it is safe while GC is disallowed; the stream is only
+// called from WriteChunks() and Finish(), which the stringifier invokes where
+// the embedder may call back into V8. A lead surrogate at the end of one write
+// is held back until the next, so surrogate pairs split across writes are
+// still combined.
+class JsonStreamWriter {
+ public:
+  explicit JsonStreamWriter(v8::OutputStream* stream)
+      : stream_(stream),
+        chunk_size_(std::max(stream->GetChunkSize(), 1)) {}
+
+  template <typename Char>
+  void Write(const Char* chars, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+      base::uc16 c = chars[i];
+      if (V8_LIKELY(c <= unibrow::Utf8::kMaxOneByteChar &&
+                    pending_lead_surrogate_ ==
+                        unibrow::Utf16::kNoPreviousCharacter)) {
+        buffer_.push_back(static_cast<char>(c));
+        continue;
+      }
+      WriteCharacter(c);
+    }
+  }
+
+  // Hands all complete chunks of the buffered output to the stream. Returns
+  // false if the stream aborted writing.
+  bool WriteChunks() {
+    size_t written = 0;
+    while (!aborted_ && buffer_.size() - written >= chunk_size_) {
+      WriteChunk(buffer_.data() + written, chunk_size_);
+      written += chunk_size_;
+    }
+    buffer_.erase(buffer_.begin(), buffer_.begin() + written);
+    return !aborted_;
+  }
+
+  // Writes all remaining output and ends the stream. Returns false if the
+  // stream aborted writing.
+  bool Finish() {
+    if (pending_lead_surrogate_ != unibrow::Utf16::kNoPreviousCharacter) {
+      Encode(std::exchange(pending_lead_surrogate_,
+                           unibrow::Utf16::kNoPreviousCharacter));
+    }
+    if (!WriteChunks()) return false;
+    if (!buffer_.empty()) WriteChunk(buffer_.data(), buffer_.size());
+    buffer_.clear();
+    if (aborted_) return false;
+    stream_->EndOfStream();
+    return true;
+  }
+
+ private:
+  void WriteCharacter(base::uc16 c) {
+    int previous = std::exchange(pending_lead_surrogate_,
+                                 unibrow::Utf16::kNoPreviousCharacter);
+    if (unibrow::Utf16::IsSurrogatePair(previous, c)) {
+      Encode(unibrow::Utf16::CombineSurrogatePair(previous, c));
+      return;
+    }
+    if (previous != unibrow::Utf16::kNoPreviousCharacter) Encode(previous);
+    if (unibrow::Utf16::IsLeadSurrogate(c)) {
+      pending_lead_surrogate_ = c;
+      return;
+    }
+    Encode(c);
+  }
+
+  void Encode(unibrow::uchar c) {
+    char bytes[unibrow::Utf8::kMaxEncodedSize];
+    size_t length = unibrow::Utf8::Encode(
+        bytes, c, unibrow::Utf16::kNoPreviousCharacter, true);
+    buffer_.insert(buffer_.end(), bytes, bytes + length);
+  }
+
+  void WriteChunk(const char* data, size_t length) {
+    DCHECK(!aborted_);
+    if (stream_->WriteAsciiChunk(const_cast<char*>(data),
+                                 static_cast<int>(length)) ==
+        v8::OutputStream::kAbort) {
+      aborted_ = true;
+    }
+  }
+
+  v8::OutputStream* const stream_;
+  const size_t chunk_size_;
+  std::vector<char> buffer_;
+  int pending_lead_surrogate_ = unibrow::Utf16::kNoPreviousCharacter;
+  bool aborted_ = false;
+};
+
 class JsonStringifier {
  public:
   explicit JsonStringifier(Isolate* isolate);
@@ -44,6 +140,12 @@ class JsonStringifier {
   V8_WARN_UNUSED_RESULT MaybeDirectHandle<Object> Stringify(
       Handle<JSAny> object, Handle<JSAny> replacer, Handle<Object> gap);
 
+  // Like Stringify, but hands the output to |stream| whenever the current part
+  // is full instead of growing it. Returns false if the stream aborted.
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Handle<JSAny> object, Handle<JSAny> replacer, Handle<Object> gap,
+      v8::OutputStream* stream);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
@@ -432,6 +534,8 @@ class JsonStringifier {
 
   V8_NOINLINE void Extend();
   V8_NOINLINE void ChangeEncoding();
+  void FlushToStream();
+  bool WriteToStream();
 
   Isolate* isolate_;
   String::Encoding encoding_;
@@ -447,6 +551,8 @@ class JsonStringifier {
   int stack_nesting_level_;
   bool overflowed_;
   bool need_stack_;
+  // Only set while streaming, see StringifyToStream.
+  JsonStreamWriter* stream_writer_ = nullptr;
 
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
@@ -647,6 +753,42 @@ MaybeDirectHandle<Object> JsonStringifier::Stringify(Handle<JSAny> object,
   return MaybeDirectHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToStream(Handle<JSAny> object,
+                                               Handle<JSAny> replacer,
+                                               Handle<Object> gap,
+                                               v8::OutputStream* stream) {
+  if (!InitializeReplacer(replacer)) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  // Output that was already handed to the stream can't be taken back, so
+  // serialize with the stack from the start instead of restarting on
+  // NEED_STACK.
+  need_stack_ = true;
+  JsonStreamWriter writer(stream);
+  stream_writer_ = &writer;
+  Result result = SerializeObject(object);
+  DCHECK_NE(result, NEED_STACK);
+  if (result == EXCEPTION) {
+    stream_writer_ = nullptr;
+    if (!isolate_->has_exception()) return Just(false);
+    return Nothing<bool>();
+  }
+  DCHECK(!overflowed_);
+  if (result == SUCCESS) {
+    FlushToStream();
+  } else {
+    DCHECK_EQ(result, UNCHANGED);
+    DCHECK_EQ(current_index_, 0);
+  }
+  stream_writer_ = nullptr;
+  return Just(writer.Finish());
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<JSAny> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -965,6 +1107,12 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<JSAny> object,
       IsExceptionHole(isolate_->stack_guard()->HandleInterrupts(), isolate_)) {
     return EXCEPTION;
   }
+  // Between values the embedder may call back into V8, so this is where the
+  // output is handed to the stream. Once the stream aborted, unwind like for
+  // an exception, just without one pending.
+  if (V8_UNLIKELY(stream_writer_ != nullptr) && !WriteToStream()) {
+    return EXCEPTION;
+  }
 
   DirectHandle<JSAny> initial_value = object;
   PtrComprCageBase cage_base(isolate_);
@@ -1766,7 +1914,29 @@ bool JsonStringifier::SerializeString(Handle<String> object) {
   }
 }
 
+void JsonStringifier::FlushToStream() {
+  DCHECK_NOT_NULL(stream_writer_);
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    stream_writer_->Write(one_byte_ptr_, current_index_);
+  } else {
+    stream_writer_->Write(two_byte_ptr_, current_index_);
+  }
+  current_index_ = 0;
+}
+
+bool JsonStringifier::WriteToStream() {
+  FlushToStream();
+  return stream_writer_->WriteChunks();
+}
+
 void JsonStringifier::Extend() {
+  // When streaming, make room by moving the current part to the stream writer.
+  // This may happen while GC is disallowed, so the writer only buffers it. The
+  // part only grows if a single append doesn't fit into an empty part.
+  if (stream_writer_ != nullptr && current_index_ > 0) {
+    FlushToStream();
+    return;
+  }
   if (part_length_ >= String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
     current_index_ = 0;
@@ -3579,5 +3749,12 @@ MaybeDirectHandle<Object> JsonStringify(Isolate* isolate, Handle<JSAny> object,
   }
 }
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<JSAny> object,
+                                  Handle<JSAny> replacer, Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToStream(object, replacer, gap, stream);
+}
+
 }  // namespace internal
 }  // namespace v8
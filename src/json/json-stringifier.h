@@ -8,11 +8,21 @@
 #include "src/objects/objects.h"
 
 namespace v8 {
+
+class OutputStream;
+
 namespace internal {
 
 V8_WARN_UNUSED_RESULT MaybeDirectHandle<Object> JsonStringify(
     Isolate* isolate, Handle<JSAny> object, Handle<JSAny> replacer,
     Handle<Object> gap);
+
+// Like JsonStringify, but writes the result to |stream| as UTF-8 instead of
+// creating a string. Returns Nothing if an exception was thrown and false if
+// the stream aborted writing.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToStream(
+    Isolate* isolate, Handle<JSAny> object, Handle<JSAny> replacer,
+    Handle<Object> gap, v8::OutputStream* stream);
 }  // namespace internal
 }  // namespace v8
 
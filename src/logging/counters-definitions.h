@@ -251,6 +251,8 @@ namespace internal {
      V8.TurboFanOptimizeNonConcurrentTotalTime, 10000000, MICROSECOND)         \
   HT(turbofan_optimize_concurrent_total_time,                                  \
      V8.TurboFanOptimizeConcurrentTotalTime, 10000000, MICROSECOND)            \
+  HT(turbofan_optimize_queue_wait_time, V8.TurboFanOptimizeQueueWaitTime,      \
+     10000000, MICROSECOND)                                                    \
   HT(turbofan_osr_prepare, V8.TurboFanOptimizeForOnStackReplacementPrepare,    \
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_execute, V8.TurboFanOptimizeForOnStackReplacementExecute,    \
@@ -374,6 +376,9 @@ namespace internal {
   SC(lo_space_bytes_available, V8.MemoryLoSpaceBytesAvailable)                 \
   SC(lo_space_bytes_committed, V8.MemoryLoSpaceBytesCommitted)                 \
   SC(lo_space_bytes_used, V8.MemoryLoSpaceBytesUsed)                           \
+  /* Memory reserved for huge page regions and the part backing pages. */      \
+  SC(huge_page_regions_kbytes, V8.MemoryHugePageRegionsKBytes)                 \
+  SC(huge_page_regions_kbytes_used, V8.MemoryHugePageRegionsKBytesUsed)        \
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_deopt_data_size, V8.WasmDeoptDataBytes)                              \
@@ -12339,8 +12339,9 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceConstructGeneric(
   if (function.has_initial_map(broker())) {
     compiler::MapRef map = function.initial_map(broker());
     if (map.GetConstructor(broker()).equals(function)) {
-      implicit_receiver = BuildInlinedAllocation(CreateJSConstructor(function),
-                                                 AllocationType::kYoung);
+      implicit_receiver =
+          BuildInlinedAllocation(CreateJSConstructor(function),
+                                 GetJSConstructorAllocationType(function));
     }
   }
   if (implicit_receiver == nullptr) {
@@ -13487,6 +13488,17 @@ VirtualObject* MaglevGraphBuilder::CreateJSConstructor(
   return object;
 }
 
+AllocationType MaglevGraphBuilder::GetJSConstructorAllocationType(
+    compiler::JSFunctionRef constructor) {
+  compiler::OptionalFeedbackVectorRef feedback_vector =
+      constructor.feedback_vector(broker());
+  if (!feedback_vector.has_value()) return AllocationType::kYoung;
+  compiler::OptionalAllocationSiteRef site =
+      feedback_vector->constructor_allocation_site(broker());
+  if (!site.has_value()) return AllocationType::kYoung;
+  return broker()->dependencies()->DependOnPretenureMode(*site);
+}
+
 VirtualObject* MaglevGraphBuilder::CreateFixedArray(
     base::Vector<ValueNode* const> values) {
   const compiler::MapRef& map = broker()->fixed_array_map();
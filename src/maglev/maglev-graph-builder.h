@@ -1502,6 +1502,8 @@ class MaglevGraphBuilder {
                                        ValueNode* iterated_object,
                                        IterationKind kind);
   VirtualObject* CreateJSConstructor(compiler::JSFunctionRef constructor);
+  AllocationType GetJSConstructorAllocationType(
+      compiler::JSFunctionRef constructor);
   VirtualObject* CreateFixedArray(base::Vector<ValueNode* const> values);
   VirtualObject* CreateContext(compiler::MapRef map, int length,
                                compiler::ScopeInfoRef scope_info,
@@ -287,12 +287,13 @@ void OffHeapCompressedObjectSlotBase<
 }
 
 template <typename CompressionScheme, typename TObject, typename Subclass>
-void OffHeapCompressedObjectSlotBase<CompressionScheme, TObject, Subclass>::
+TObject OffHeapCompressedObjectSlotBase<CompressionScheme, TObject, Subclass>::
     Release_CompareAndSwap(TObject old, TObject target) const {
   Tagged_t old_ptr = CompressionScheme::CompressObject(old.ptr());
   Tagged_t target_ptr = CompressionScheme::CompressObject(target.ptr());
-  AsAtomicTagged::Release_CompareAndSwap(TSlotBase::location(), old_ptr,
-                                         target_ptr);
+  Tagged_t result = AsAtomicTagged::Release_CompareAndSwap(
+      TSlotBase::location(), old_ptr, target_ptr);
+  return TObject(CompressionScheme::DecompressTagged(result));
 }
 
 }  // namespace v8::internal
@@ -177,7 +177,8 @@ class OffHeapCompressedObjectSlotBase : public SlotBase<Subclass, Tagged_t> {
   inline TObject Acquire_Load(PtrComprCageBase cage_base) const;
   inline void Relaxed_Store(TObject value) const;
   inline void Release_Store(TObject value) const;
-  inline void Release_CompareAndSwap(TObject old, TObject target) const;
+  // Returns the previous value of the slot.
+  inline TObject Release_CompareAndSwap(TObject old, TObject target) const;
 };
 
 template <typename CompressionScheme>
@@ -5,6 +5,7 @@
 #include "src/objects/js-array-buffer.h"
 
 #include "src/execution/protectors-inl.h"
+#include "src/heap/array-buffer-sweeper.h"
 #include "src/logging/counters.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/property-descriptor.h"
@@ -166,6 +167,8 @@ void JSArrayBuffer::DetachInternal(bool force_for_wasm_memory,
     isolate->heap()->DetachArrayBufferExtension(extension);
     std::shared_ptr<BackingStore> backing_store = RemoveExtension();
     CHECK_IMPLIES(force_for_wasm_memory, backing_store->is_wasm_memory());
+    isolate->heap()->array_buffer_sweeper()->ReleaseBackingStore(
+        std::move(backing_store));
   }
 
   if (Protectors::IsArrayBufferDetachingIntact(isolate)) {
@@ -16,6 +16,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/ic/ic.h"
 #include "src/init/bootstrapper.h"
+#include "src/objects/allocation-site.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/feedback-vector.h"
 #include "src/strings/string-builder-inl.h"
@@ -732,6 +733,8 @@ void JSFunction::CreateAndAttachFeedbackVector(
             feedback_vector->log_next_execution());
 #endif
 
+  EnsureConstructorAllocationSite(isolate, function);
+
   if (v8_flags.profile_guided_optimization &&
       v8_flags.profile_guided_optimization_for_empty_feedback_vector &&
       function->feedback_vector()->length() == 0) {
@@ -992,6 +995,28 @@ void JSFunction::EnsureHasInitialMap(Isolate* isolate,
   CHECK(IsJSReceiver(*prototype));
   JSFunction::SetInitialMap(isolate, function, map, prototype);
   map->StartInobjectSlackTracking();
+  EnsureConstructorAllocationSite(isolate, function);
+}
+
+// static
+void JSFunction::EnsureConstructorAllocationSite(
+    Isolate* isolate, DirectHandle<JSFunction> function) {
+  if (!V8_ALLOCATION_SITE_TRACKING_BOOL ||
+      !v8_flags.constructor_allocation_site_pretenuring) {
+    return;
+  }
+  if (!function->has_feedback_vector() || !function->has_initial_map() ||
+      function->initial_map()->instance_type() != JS_OBJECT_TYPE) {
+    return;
+  }
+  DirectHandle<FeedbackVector> vector(function->feedback_vector(), isolate);
+  if (!IsUndefined(vector->constructor_allocation_site(kAcquireLoad),
+                   isolate)) {
+    return;
+  }
+  DirectHandle<AllocationSite> site =
+      isolate->factory()->NewAllocationSite(true);
+  vector->set_constructor_allocation_site(*site, kReleaseStore);
 }
 
 namespace {
@@ -356,6 +356,13 @@ class JSFunction : public TorqueGeneratedJSFunction<
   V8_EXPORT_PRIVATE static void EnsureHasInitialMap(
       Isolate* isolate, DirectHandle<JSFunction> function);
 
+  // With --constructor-allocation-site-pretenuring, attaches an allocation
+  // site to the feedback vector of a constructor that has both a feedback
+  // vector and a JSObject initial map. Instances created by `new` then carry
+  // mementos for that site, and get pretenured once they tend to survive.
+  static void EnsureConstructorAllocationSite(
+      Isolate* isolate, DirectHandle<JSFunction> function);
+
   // Creates a map that matches the constructor's initial map, but with
   // [[prototype]] being new.target.prototype. Because new.target can be a
   // JSProxy, this can call back into JavaScript.
@@ -2433,9 +2433,16 @@ MaybeHandle<JSObject> JSObject::New(DirectHandle<JSFunction> constructor,
       isolate, initial_map,
       JSFunction::GetDerivedMap(isolate, constructor, new_target));
   constexpr int initial_capacity = PropertyDictionary::kInitialCapacity;
+  AllocationType allocation = AllocationType::kYoung;
+  if (!site.is_null()) {
+    if (!AllocationSite::CanTrack(initial_map->instance_type())) {
+      site = {};
+    } else {
+      allocation = site->GetAllocationType();
+    }
+  }
   Handle<JSObject> result = isolate->factory()->NewFastOrSlowJSObjectFromMap(
-      initial_map, initial_capacity, AllocationType::kYoung, site,
-      new_js_object_type);
+      initial_map, initial_capacity, allocation, site, new_js_object_type);
   return result;
 }
 
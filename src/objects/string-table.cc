@@ -4,10 +4,12 @@
 
 #include "src/objects/string-table.h"
 
+#include <algorithm>
 #include <atomic>
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
+#include "src/base/platform/yield-processor.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/common/ptr-compr-inl.h"
@@ -66,6 +68,40 @@ class StringTable::OffHeapStringHashSet
     // Do nothing, since the entry size is 1 (just the key).
   }
 
+  // Inserts {string} into the first empty entry of {key}'s probe sequence,
+  // unless a matching string is found first. Unlike AddAt(), this is safe to
+  // call concurrently with other insertions and lookups, but it does not
+  // update the number of elements and never reuses deleted entries. Returns
+  // the string that is in the table for {key} afterwards.
+  template <typename IsolateT, typename StringTableKey>
+  Tagged<String> InsertConcurrently(IsolateT* isolate, StringTableKey* key,
+                                    Tagged<String> string, bool* inserted) {
+    uint32_t count = 1;
+    for (InternalIndex entry = FirstProbe(key->hash(), capacity_);;
+         entry = NextProbe(entry, count++, capacity_)) {
+      Tagged<Object> element = GetKey(isolate, entry);
+      if (element == empty_element()) {
+        if (slot(entry).Release_CompareAndSwap(empty_element(), string) ==
+            empty_element()) {
+          *inserted = true;
+          return string;
+        }
+        // Another thread filled the entry in the meantime.
+        element = GetKey(isolate, entry);
+      }
+      if (element == deleted_element()) continue;
+      if (KeyIsMatch(isolate, key, element)) {
+        *inserted = false;
+        return Cast<String>(element);
+      }
+    }
+  }
+
+  void ElementsAddedConcurrently(int count) {
+    DCHECK_LT(number_of_elements_ + count, capacity());
+    number_of_elements_ += count;
+  }
+
  private:
   friend class StringTable::Data;
 };
@@ -80,6 +116,14 @@ class StringTable::OffHeapStringHashSet
 // The elements themselves are stored as an open-addressed hash table, with
 // quadratic probing and Smi 0 and Smi 1 as the empty and deleted sentinels,
 // respectively.
+//
+// With --concurrent-string-table-insertion, strings are inserted into empty
+// entries with a compare-and-swap instead of under the write mutex. Such
+// insertions draw from a budget of entries that can be filled without
+// exceeding the table's load factor, and are added to the element count only
+// once the table is accessed exclusively. Exclusive access (resizing, reusing
+// deleted entries, in-place internalization) waits for in-flight concurrent
+// insertions to finish; inserters that observe it fall back to the mutex.
 class StringTable::Data {
  public:
   static std::unique_ptr<Data> New(int capacity);
@@ -107,13 +151,36 @@ class StringTable::Data {
   Data* PreviousData() { return previous_data_.get(); }
   void DropPreviousData() { previous_data_.reset(); }
 
+  int NumberOfElements() const {
+    return table_.number_of_elements() +
+           concurrent_insertions_.load(std::memory_order_relaxed);
+  }
+
+  // Returns true if the caller may insert a single string with
+  // OffHeapStringHashSet::InsertConcurrently(), in which case it has to call
+  // LeaveConcurrentInsertion() afterwards.
+  bool TryEnterConcurrentInsertion();
+  void LeaveConcurrentInsertion(bool inserted);
+
+  // Must be called with the write mutex held or in a safepoint. Waits for
+  // concurrent insertions to finish and accounts for them in the table's
+  // element count.
+  void StartExclusiveAccess();
+  void EndExclusiveAccess();
+
   void Print(PtrComprCageBase cage_base) const;
   size_t GetCurrentMemoryUsage() const;
 
  private:
   explicit Data(int capacity) : table_(capacity) {}
 
+  int ComputeConcurrentInsertionBudget() const;
+
   std::unique_ptr<Data> previous_data_;
+  std::atomic<bool> exclusive_access_{false};
+  std::atomic<int> concurrent_inserters_{0};
+  std::atomic<int> concurrent_insertion_budget_{0};
+  std::atomic<int> concurrent_insertions_{0};
   OffHeapStringHashSet table_;
 };
 
@@ -136,6 +203,62 @@ size_t StringTable::Data::GetCurrentMemoryUsage() const {
   return usage;
 }
 
+bool StringTable::Data::TryEnterConcurrentInsertion() {
+  // Pairs with the sequentially consistent accesses in StartExclusiveAccess():
+  // either the exclusive access is observed here, or this insertion is
+  // observed there.
+  concurrent_inserters_.fetch_add(1, std::memory_order_seq_cst);
+  if (!exclusive_access_.load(std::memory_order_seq_cst)) {
+    int budget = concurrent_insertion_budget_.load(std::memory_order_relaxed);
+    while (budget > 0) {
+      if (concurrent_insertion_budget_.compare_exchange_weak(
+              budget, budget - 1, std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+  }
+  concurrent_inserters_.fetch_sub(1, std::memory_order_release);
+  return false;
+}
+
+void StringTable::Data::LeaveConcurrentInsertion(bool inserted) {
+  if (inserted) {
+    concurrent_insertions_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    concurrent_insertion_budget_.fetch_add(1, std::memory_order_relaxed);
+  }
+  concurrent_inserters_.fetch_sub(1, std::memory_order_release);
+}
+
+void StringTable::Data::StartExclusiveAccess() {
+  exclusive_access_.store(true, std::memory_order_seq_cst);
+  while (concurrent_inserters_.load(std::memory_order_seq_cst) > 0) {
+    YIELD_PROCESSOR;
+  }
+  table_.ElementsAddedConcurrently(
+      concurrent_insertions_.exchange(0, std::memory_order_relaxed));
+}
+
+void StringTable::Data::EndExclusiveAccess() {
+  DCHECK(exclusive_access_.load(std::memory_order_relaxed));
+  DCHECK_EQ(0, concurrent_inserters_.load(std::memory_order_relaxed));
+  concurrent_insertion_budget_.store(ComputeConcurrentInsertionBudget(),
+                                     std::memory_order_relaxed);
+  exclusive_access_.store(false, std::memory_order_release);
+}
+
+int StringTable::Data::ComputeConcurrentInsertionBudget() const {
+  if (!v8_flags.concurrent_string_table_insertion) return 0;
+  // The largest number of elements for which
+  // OffHeapHashTableBase::HasSufficientCapacityToAdd() still holds.
+  const int capacity = table_.capacity();
+  const int max_elements =
+      std::min({capacity - 1,
+                capacity - 2 * table_.number_of_deleted_elements(),
+                (2 * capacity) / 3});
+  return std::max(0, max_elements - table_.number_of_elements());
+}
+
 std::unique_ptr<StringTable::Data> StringTable::Data::New(int capacity) {
   return std::unique_ptr<Data>(new (capacity) Data(capacity));
 }
@@ -173,7 +296,7 @@ int StringTable::Capacity() const {
 int StringTable::NumberOfElements() const {
   {
     base::MutexGuard table_write_guard(&write_mutex_);
-    return data_.load(std::memory_order_relaxed)->table().number_of_elements();
+    return data_.load(std::memory_order_relaxed)->NumberOfElements();
   }
 }
 
@@ -276,6 +399,10 @@ class InternalizedStringKey final : public StringTableKey {
     return internalized_string_.ToHandleChecked();
   }
 
+  bool InternalizesInPlace() const {
+    return !maybe_internalized_map_.is_null();
+  }
+
  private:
   DirectHandle<String> string_;
   // Copy of the string to be internalized (only set if the string is not
@@ -331,6 +458,17 @@ void SetInternalizedReference(Isolate* isolate, Tagged<String> string,
   }
 }
 
+// Strings that are internalized in place must only transition once their
+// insertion is certain, so they are always inserted under the write mutex.
+template <typename StringTableKey>
+bool CanInsertConcurrently(StringTableKey* key) {
+  return true;
+}
+
+bool CanInsertConcurrently(InternalizedStringKey* key) {
+  return !key->InternalizesInPlace();
+}
+
 }  // namespace
 
 DirectHandle<String> StringTable::LookupString(Isolate* isolate,
@@ -396,7 +534,8 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
   //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
+  //     mutex, except for concurrent insertions into empty entries (see
+  //     StringTable::Data), which are excluded while the mutex holder writes,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
   //     table,
@@ -446,6 +585,25 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
 
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
+
+  // Try to insert without taking the lock. This fails if the table needs to be
+  // resized or is otherwise being written to under the lock, in which case we
+  // take the lock below.
+  if (v8_flags.concurrent_string_table_insertion &&
+      CanInsertConcurrently(key)) {
+    Data* const data = data_.load(std::memory_order_acquire);
+    if (data->TryEnterConcurrentInsertion()) {
+      DirectHandle<String> new_string = key->GetHandleForInsertion(isolate_);
+      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+      bool inserted;
+      Tagged<String> result = data->table().InsertConcurrently(
+          isolate, key, *new_string, &inserted);
+      data->LeaveConcurrentInsertion(inserted);
+      if (inserted) return new_string;
+      return direct_handle(result, isolate);
+    }
+  }
+
   {
     base::MutexGuard table_write_guard(&write_mutex_);
 
@@ -456,25 +614,26 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
     // added after the check.
     entry = table.FindEntryOrInsertionEntry(isolate, key, key->hash());
 
+    DirectHandle<String> result;
     Tagged<Object> element = table.GetKey(isolate, entry);
     if (element == OffHeapStringHashSet::empty_element()) {
       // This entry is empty, so write it and register that we added an
       // element.
-      DirectHandle<String> new_string = key->GetHandleForInsertion(isolate_);
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      table.AddAt(isolate, entry, *new_string);
-      return new_string;
+      result = key->GetHandleForInsertion(isolate_);
+      DCHECK_IMPLIES(v8_flags.shared_string_table, result->IsShared());
+      table.AddAt(isolate, entry, *result);
     } else if (element == OffHeapStringHashSet::deleted_element()) {
       // This entry was deleted, so overwrite it and register that we
       // overwrote a deleted element.
-      DirectHandle<String> new_string = key->GetHandleForInsertion(isolate_);
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      table.OverwriteDeletedAt(isolate, entry, *new_string);
-      return new_string;
+      result = key->GetHandleForInsertion(isolate_);
+      DCHECK_IMPLIES(v8_flags.shared_string_table, result->IsShared());
+      table.OverwriteDeletedAt(isolate, entry, *result);
     } else {
       // Return the existing string as a handle.
-      return direct_handle(Cast<String>(element), isolate);
+      result = direct_handle(Cast<String>(element), isolate);
     }
+    data->EndExclusiveAccess();
+    return result;
   }
 }
 
@@ -506,12 +665,19 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
   // the lock is held.
   Data* data = data_.load(std::memory_order_relaxed);
 
+  // The returned data is accessed exclusively until the caller calls
+  // EndExclusiveAccess() on it.
+  data->StartExclusiveAccess();
+
   int new_capacity;
   if (data->table().ShouldResizeToAdd(additional_elements, &new_capacity)) {
     std::unique_ptr<Data> new_data =
         Data::Resize(cage_base, std::unique_ptr<Data>(data), new_capacity);
     // `new_data` is the new owner of `data`.
     DCHECK_EQ(new_data->PreviousData(), data);
+    // The old data remains in exclusive access, so that concurrent inserters
+    // still seeing it take the lock and then find the new data.
+    new_data->StartExclusiveAccess();
     // Release-store the new data pointer as `data_`, so that it can be
     // acquire-loaded by other threads. This string table becomes the owner of
     // the pointer.
@@ -693,6 +859,7 @@ void StringTable::InsertForIsolateDeserialization(
       DCHECK_IMPLIES(v8_flags.shared_string_table, inserted_string->IsShared());
       data->table().AddAt(isolate, entry, *inserted_string);
     }
+    data->EndExclusiveAccess();
   }
 
   DCHECK_EQ(NumberOfElements(), length);
@@ -712,6 +879,7 @@ void StringTable::InsertEmptyStringForBootstrapping(Isolate* isolate) {
 
     DCHECK_IMPLIES(v8_flags.shared_string_table, empty_string->IsShared());
     data->table().AddAt(isolate, entry, *empty_string);
+    data->EndExclusiveAccess();
   }
   DCHECK_EQ(NumberOfElements(), 1);
 }
@@ -745,7 +913,12 @@ void StringTable::NotifyElementsRemoved(int count) {
   // are paused, so the load can be relaxed.
   isolate_->heap()->safepoint()->AssertActive();
   DCHECK_NE(isolate_->heap()->gc_state(), Heap::NOT_IN_GC);
-  data_.load(std::memory_order_relaxed)->table().ElementsRemoved(count);
+  Data* data = data_.load(std::memory_order_relaxed);
+  // No concurrent insertions are in flight during a safepoint, so this only
+  // accounts for past ones.
+  data->StartExclusiveAccess();
+  data->table().ElementsRemoved(count);
+  data->EndExclusiveAccess();
 }
 
 }  // namespace internal
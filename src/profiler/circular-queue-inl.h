@@ -8,58 +8,69 @@
 #include "src/profiler/circular-queue.h"
 // Include the non-inl header before the rest of the headers.
 
+#include "src/utils/allocation.h"
+
 namespace v8 {
 namespace internal {
 
-template<typename T, unsigned L>
-SamplingCircularQueue<T, L>::SamplingCircularQueue()
-    : enqueue_pos_(buffer_),
-      dequeue_pos_(buffer_) {
+template <typename T>
+SamplingCircularQueue<T>::SamplingCircularQueue(size_t length)
+    : buffer_(static_cast<Entry*>(
+          AlignedAllocWithRetry(length * sizeof(Entry), alignof(Entry)))),
+      length_(length) {
+  DCHECK_GT(length_, 0);
+  for (size_t i = 0; i < length_; ++i) new (&buffer_[i]) Entry(i);
 }
 
-template <typename T, unsigned L>
-SamplingCircularQueue<T, L>::~SamplingCircularQueue() = default;
+template <typename T>
+SamplingCircularQueue<T>::~SamplingCircularQueue() {
+  for (size_t i = 0; i < length_; ++i) buffer_[i].~Entry();
+  AlignedFree(buffer_);
+}
 
-template<typename T, unsigned L>
-T* SamplingCircularQueue<T, L>::Peek() {
-  base::SeqCst_MemoryFence();
-  if (base::Acquire_Load(&dequeue_pos_->marker) == kFull) {
-    return &dequeue_pos_->record;
+template <typename T>
+T* SamplingCircularQueue<T>::Peek() {
+  Entry* entry = &buffer_[dequeue_pos_ % length_];
+  if (entry->sequence.load(std::memory_order_acquire) == dequeue_pos_ + 1) {
+    return &entry->record;
   }
   return nullptr;
 }
 
-
-template<typename T, unsigned L>
-void SamplingCircularQueue<T, L>::Remove() {
-  base::Release_Store(&dequeue_pos_->marker, kEmpty);
-  dequeue_pos_ = Next(dequeue_pos_);
+template <typename T>
+void SamplingCircularQueue<T>::Remove() {
+  Entry* entry = &buffer_[dequeue_pos_ % length_];
+  DCHECK_EQ(entry->sequence.load(std::memory_order_relaxed), dequeue_pos_ + 1);
+  entry->sequence.store(dequeue_pos_ + length_, std::memory_order_release);
+  ++dequeue_pos_;
 }
 
-
-template<typename T, unsigned L>
-T* SamplingCircularQueue<T, L>::StartEnqueue() {
-  base::SeqCst_MemoryFence();
-  if (base::Acquire_Load(&enqueue_pos_->marker) == kEmpty) {
-    return &enqueue_pos_->record;
+template <typename T>
+T* SamplingCircularQueue<T>::StartEnqueue() {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    Entry* entry = &buffer_[pos % length_];
+    size_t sequence = entry->sequence.load(std::memory_order_acquire);
+    if (sequence == pos) {
+      // The entry is free; claim it unless another producer got there first.
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        return &entry->record;
+      }
+    } else if (sequence < pos) {
+      // The entry has not been removed since the previous round: full.
+      return nullptr;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
   }
-  return nullptr;
 }
 
-
-template<typename T, unsigned L>
-void SamplingCircularQueue<T, L>::FinishEnqueue() {
-  base::Release_Store(&enqueue_pos_->marker, kFull);
-  enqueue_pos_ = Next(enqueue_pos_);
-}
-
-
-template<typename T, unsigned L>
-typename SamplingCircularQueue<T, L>::Entry* SamplingCircularQueue<T, L>::Next(
-    Entry* entry) {
-  Entry* next = entry + 1;
-  if (next == &buffer_[L]) return buffer_;
-  return next;
+template <typename T>
+void SamplingCircularQueue<T>::FinishEnqueue(T* record) {
+  Entry* entry = reinterpret_cast<Entry*>(record);
+  size_t pos = entry->sequence.load(std::memory_order_relaxed);
+  entry->sequence.store(pos + 1, std::memory_order_release);
 }
 
 }  // namespace internal
@@ -5,33 +5,39 @@
 #ifndef V8_PROFILER_CIRCULAR_QUEUE_H_
 #define V8_PROFILER_CIRCULAR_QUEUE_H_
 
-#include "src/base/atomicops.h"
+#include <atomic>
+
 #include "src/common/globals.h"
 
 namespace v8 {
 namespace internal {
 
 // Lock-free cache-friendly sampling circular queue for large
-// records. Intended for fast transfer of large records between a
-// single producer and a single consumer. If the queue is full,
-// StartEnqueue will return nullptr. The queue is designed with
-// a goal in mind to evade cache lines thrashing by preventing
-// simultaneous reads and writes to adjanced memory locations.
-template<typename T, unsigned Length>
+// records. Intended for fast transfer of large records between
+// producers and a single consumer. Producers may run concurrently, e.g.
+// signal handlers on different threads: each StartEnqueue claims its own
+// entry, and the consumer sees the entries in the order they were claimed
+// once they are finished. If the queue is full, StartEnqueue will return
+// nullptr. The queue is designed with a goal in mind to evade cache lines
+// thrashing by preventing simultaneous reads and writes to adjanced memory
+// locations.
+template <typename T>
 class SamplingCircularQueue {
  public:
   // Executed on the application thread.
-  SamplingCircularQueue();
+  explicit SamplingCircularQueue(size_t length);
   ~SamplingCircularQueue();
   SamplingCircularQueue(const SamplingCircularQueue&) = delete;
   SamplingCircularQueue& operator=(const SamplingCircularQueue&) = delete;
 
+  size_t length() const { return length_; }
+
   // StartEnqueue returns a pointer to a memory location for storing the next
   // record or nullptr if all entries are full at the moment.
   T* StartEnqueue();
   // Notifies the queue that the producer has complete writing data into the
   // memory returned by StartEnqueue and it can be passed to the consumer.
-  void FinishEnqueue();
+  void FinishEnqueue(T* record);
 
   // Executed on the consumer (analyzer) thread.
   // Retrieves, but does not remove, the head of this queue, returning nullptr
@@ -41,24 +47,21 @@ class SamplingCircularQueue {
   void Remove();
 
  private:
-  // Reserved values for the entry marker.
-  enum {
-    kEmpty,  // Marks clean (processed) entries.
-    kFull    // Marks entries already filled by the producer but not yet
-             // completely processed by the consumer.
-  };
-
+  // The sequence number of an entry is its position in the queue while it is
+  // free to be claimed, one more than that once it has been filled, and its
+  // next position after the consumer has removed it.
   struct alignas(PROCESSOR_CACHE_LINE_SIZE) Entry {
-    Entry() : marker(kEmpty) {}
+    explicit Entry(size_t position) : sequence(position) {}
+    // Must stay the first member, FinishEnqueue maps records back to entries.
     T record;
-    base::Atomic32 marker;
+    std::atomic<size_t> sequence;
   };
+  static_assert(std::atomic<size_t>::is_always_lock_free);
 
-  Entry* Next(Entry* entry);
-
-  Entry buffer_[Length];
-  alignas(PROCESSOR_CACHE_LINE_SIZE) Entry* enqueue_pos_;
-  alignas(PROCESSOR_CACHE_LINE_SIZE) Entry* dequeue_pos_;
+  Entry* buffer_;
+  const size_t length_;
+  alignas(PROCESSOR_CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+  alignas(PROCESSOR_CACHE_LINE_SIZE) size_t dequeue_pos_ = 0;
 };
 
 
@@ -70,12 +70,13 @@ void ReportBuiltinEventRecord::UpdateCodeMap(
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
-TickSample* SamplingEventsProcessor::StartTickSample() {
+TickSampleEventRecord* SamplingEventsProcessor::StartTickSample() {
   void* address = ticks_buffer_.StartEnqueue();
-  if (address == nullptr) return nullptr;
-  TickSampleEventRecord* evt =
-      new (address) TickSampleEventRecord(last_code_event_id_);
-  return &evt->sample;
+  if (address == nullptr) {
+    dropped_ticks_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  return new (address) TickSampleEventRecord(last_code_event_id_);
 }
 
 void CodeDeleteEventRecord::UpdateCodeMap(
@@ -84,8 +85,9 @@ void CodeDeleteEventRecord::UpdateCodeMap(
   CHECK(removed);
 }
 
-void SamplingEventsProcessor::FinishTickSample() {
-  ticks_buffer_.FinishEnqueue();
+void SamplingEventsProcessor::FinishTickSample(
+    TickSampleEventRecord* record) {
+  ticks_buffer_.FinishEnqueue(record);
 }
 
 }  // namespace internal
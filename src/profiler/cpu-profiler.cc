@@ -4,6 +4,7 @@
 
 #include "src/profiler/cpu-profiler.h"
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 
@@ -49,14 +50,15 @@ class CpuSampler : public sampler::Sampler {
           ProfilerStats::Reason::kIsolateNotLocked);
       return;
     }
-    TickSample* sample = processor_->StartTickSample();
-    if (sample == nullptr) {
+    TickSampleEventRecord* record = processor_->StartTickSample();
+    if (record == nullptr) {
       ProfilerStats::Instance()->AddReason(
           ProfilerStats::Reason::kTickBufferFull);
       return;
     }
     // Every bailout up until here resulted in a dropped sample. From now on,
     // the sample is created in the buffer.
+    TickSample* sample = &record->sample;
     sample->Init(isolate, regs, TickSample::kIncludeCEntryFrame,
                  /* update_stats */ true,
                  /* use_simulator_reg_state */ true, processor_->period());
@@ -64,7 +66,7 @@ class CpuSampler : public sampler::Sampler {
       if (sample->state == JS) ++js_sample_count_;
       if (sample->state == EXTERNAL) ++external_sample_count_;
     }
-    processor_->FinishTickSample();
+    processor_->FinishTickSample(record);
   }
 
  private:
@@ -124,6 +126,9 @@ SamplingEventsProcessor::SamplingEventsProcessor(
     ProfilerCodeObserver* code_observer, CpuProfilesCollection* profiles,
     base::TimeDelta period, bool use_precise_sampling)
     : ProfilerEventsProcessor(isolate, symbolizer, code_observer, profiles),
+      ticks_buffer_(std::max<size_t>(
+          1, v8_flags.cpu_profiler_tick_buffer_size /
+                 sizeof(TickSampleEventRecord))),
       sampler_(new CpuSampler(isolate, this)),
       period_(period),
       use_precise_sampling_(use_precise_sampling) {
@@ -253,6 +258,11 @@ void SamplingEventsProcessor::SymbolizeAndAddToProfiles(
       tick_sample.trace_id_);
 }
 
+void SamplingEventsProcessor::AccountDroppedTicks() {
+  unsigned dropped = dropped_ticks_.exchange(0, std::memory_order_relaxed);
+  if (dropped > 0) profiles_->AddDroppedSamplesToCurrentProfiles(dropped);
+}
+
 ProfilerEventsProcessor::SampleProcessingResult
 SamplingEventsProcessor::ProcessOneSample() {
   TickSampleEventRecord record1;
@@ -296,6 +306,7 @@ void SamplingEventsProcessor::Run() {
       }
       now = base::TimeTicks::Now();
     } while (result != NoSamplesInQueue && now < nextSampleTime);
+    AccountDroppedTicks();
 
     if (nextSampleTime > now) {
 #if V8_OS_WIN
@@ -340,6 +351,7 @@ void SamplingEventsProcessor::Run() {
       result = ProcessOneSample();
     } while (result == OneSampleProcessed);
   } while (ProcessCodeEvent());
+  AccountDroppedTicks();
 }
 
 void SamplingEventsProcessor::SetSamplingInterval(base::TimeDelta period) {
@@ -237,11 +237,12 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   // Tick sample events are filled directly in the buffer of the circular
   // queue (because the structure is of fixed width, but usually not all
   // stack frame entries are filled.) This method returns a pointer to the
-  // next record of the buffer.
-  // These methods are not thread-safe and should only ever be called by one
-  // producer (from CpuSampler::SampleStack()). For testing, use AddSample.
-  inline TickSample* StartTickSample();
-  inline void FinishTickSample();
+  // next record of the buffer, or nullptr if the buffer is full, in which
+  // case the dropped tick is accounted to the current profiles.
+  // These methods are called from CpuSampler::SampleStack(), possibly on
+  // several threads at once. For testing, use AddSample.
+  inline TickSampleEventRecord* StartTickSample();
+  inline void FinishTickSample(TickSampleEventRecord* record);
 
   sampler::Sampler* sampler() { return sampler_.get(); }
   base::TimeDelta period() const { return period_; }
@@ -249,12 +250,12 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
  private:
   SampleProcessingResult ProcessOneSample() override;
   void SymbolizeAndAddToProfiles(const TickSampleEventRecord* record);
+  void AccountDroppedTicks();
 
-  static const size_t kTickSampleBufferSize = 512 * KB;
-  static const size_t kTickSampleQueueLength =
-      kTickSampleBufferSize / sizeof(TickSampleEventRecord);
-  SamplingCircularQueue<TickSampleEventRecord,
-                        kTickSampleQueueLength> ticks_buffer_;
+  SamplingCircularQueue<TickSampleEventRecord> ticks_buffer_;
+  // Ticks dropped because |ticks_buffer_| was full, not yet accounted to the
+  // current profiles.
+  std::atomic<unsigned> dropped_ticks_{0};
   std::unique_ptr<sampler::Sampler> sampler_;
   base::TimeDelta period_;           // Samples & code events processing period.
   const bool use_precise_sampling_;  // Whether or not busy-waiting is used for
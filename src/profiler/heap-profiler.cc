@@ -133,16 +133,49 @@ const char* HeapProfiler::CopyNameForHeapSnapshot(const char* name) {
 
 HeapSnapshot* HeapProfiler::TakeSnapshot(
     const v8::HeapProfiler::HeapSnapshotOptions options) {
-  is_taking_snapshot_ = true;
   HeapSnapshot* result =
       new HeapSnapshot(this, options.snapshot_mode, options.numerics_mode);
+  if (!GenerateSnapshot(result, options)) {
+    delete result;
+    return nullptr;
+  }
+  snapshots_.emplace_back(result);
+  return result;
+}
+
+bool HeapProfiler::TakeSnapshotToStream(
+    const v8::HeapProfiler::HeapSnapshotOptions options,
+    v8::OutputStream* stream) {
+  bool result;
+  {
+    HeapSnapshot snapshot(this, options.snapshot_mode, options.numerics_mode);
+    HeapSnapshotBinarySerializer serializer(&snapshot, stream);
+    serializer.StartStreaming();
+    if (GenerateSnapshot(&snapshot, options)) {
+      result = serializer.FinishStreaming();
+    } else {
+      snapshot.set_edge_stream(nullptr);
+      result = false;
+    }
+  }
+  // The snapshot is not retained, so neither are the names it used.
+  MaybeClearStringsStorage();
+  return result;
+}
+
+bool HeapProfiler::GenerateSnapshot(
+    HeapSnapshot* snapshot,
+    const v8::HeapProfiler::HeapSnapshotOptions& options) {
+  is_taking_snapshot_ = true;
+  bool result = false;
 
   // We need a stack marker here to allow deterministic passes over the stack.
   // The garbage collection and the filling of references in GenerateSnapshot
   // should scan the same part of the stack.
-  heap()->stack().SetMarkerIfNeededAndCallback([this, &options, &result]() {
+  heap()->stack().SetMarkerIfNeededAndCallback([this, &options, snapshot,
+                                                &result]() {
     std::optional<CppClassNamesAsHeapObjectNameScope> use_cpp_class_name;
-    if (result->expose_internals() && heap()->cpp_heap()) {
+    if (snapshot->expose_internals() && heap()->cpp_heap()) {
       use_cpp_class_name.emplace(heap()->cpp_heap());
     }
 
@@ -150,15 +183,10 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
     // TODO(https://crbug.com/333672197): remove.
     START_ALLOW_USE_DEPRECATED()
     HeapSnapshotGenerator generator(
-        result, options.control, options.global_object_name_resolver,
+        snapshot, options.control, options.global_object_name_resolver,
         options.context_name_resolver, heap(), options.stack_state);
     END_ALLOW_USE_DEPRECATED()
-    if (!generator.GenerateSnapshot()) {
-      delete result;
-      result = nullptr;
-    } else {
-      snapshots_.emplace_back(result);
-    }
+    result = generator.GenerateSnapshot();
   });
   ids_->RemoveDeadEntries();
   if (native_move_listener_) {
@@ -237,6 +265,14 @@ v8::AllocationProfile* HeapProfiler::GetAllocationProfile() {
   }
 }
 
+v8::AllocationProfile* HeapProfiler::GetAllocationProfileDelta() {
+  if (sampling_heap_profiler_) {
+    return sampling_heap_profiler_->GetAllocationProfileDelta();
+  } else {
+    return nullptr;
+  }
+}
+
 void HeapProfiler::StartHeapObjectsTracking(bool track_allocations) {
   ids_->UpdateHeapObjectsMap();
   if (native_move_listener_) {
@@ -72,12 +72,17 @@ class HeapProfiler : public HeapObjectAllocationTracker {
                           std::string filename);
   V8_EXPORT_PRIVATE std::string TakeSnapshotToString(
       const v8::HeapProfiler::HeapSnapshotOptions options);
+  // Takes a snapshot and streams it out in the binary format while it is
+  // being generated, without retaining it.
+  bool TakeSnapshotToStream(const v8::HeapProfiler::HeapSnapshotOptions options,
+                            v8::OutputStream* stream);
 
   bool StartSamplingHeapProfiler(uint64_t sample_interval, int stack_depth,
                                  v8::HeapProfiler::SamplingFlags);
   void StopSamplingHeapProfiler();
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
   AllocationProfile* GetAllocationProfile();
+  AllocationProfile* GetAllocationProfileDelta();
 
   void StartHeapObjectsTracking(bool track_allocations);
   void StopHeapObjectsTracking();
@@ -157,6 +162,8 @@ class HeapProfiler : public HeapObjectAllocationTracker {
 
  private:
   void MaybeClearStringsStorage();
+  bool GenerateSnapshot(HeapSnapshot* snapshot,
+                        const v8::HeapProfiler::HeapSnapshotOptions& options);
 
   Heap* heap() const;
 
@@ -296,7 +296,11 @@ void HeapEntry::SetNamedReference(HeapGraphEdge::Type type, const char* name,
                                   HeapSnapshotGenerator* generator,
                                   ReferenceVerification verification) {
   ++children_count_;
-  snapshot_->edges().emplace_back(type, name, this, entry);
+  if (V8_UNLIKELY(snapshot_->edge_stream() != nullptr)) {
+    snapshot_->edge_stream()->WriteNamedEdge(type, name, this, entry);
+  } else {
+    snapshot_->edges().emplace_back(type, name, this, entry);
+  }
   VerifyReference(type, entry, generator, verification);
 }
 
@@ -305,7 +309,11 @@ void HeapEntry::SetIndexedReference(HeapGraphEdge::Type type, int index,
                                     HeapSnapshotGenerator* generator,
                                     ReferenceVerification verification) {
   ++children_count_;
-  snapshot_->edges().emplace_back(type, index, this, entry);
+  if (V8_UNLIKELY(snapshot_->edge_stream() != nullptr)) {
+    snapshot_->edge_stream()->WriteIndexedEdge(type, index, this, entry);
+  } else {
+    snapshot_->edges().emplace_back(type, index, this, entry);
+  }
   VerifyReference(type, entry, generator, verification);
 }
 
@@ -502,6 +510,8 @@ String::LineEndsVector& HeapSnapshot::GetScriptLineEnds(int script_id) {
 
 void HeapSnapshot::FillChildren() {
   DCHECK(children().empty());
+  // Streamed edges have already been written out, there is nothing to link.
+  if (edge_stream_ != nullptr) return;
   int children_index = 0;
   for (HeapEntry& entry : entries()) {
     children_index = entry.set_children_index(children_index);
@@ -3436,6 +3446,10 @@ void HeapSnapshotGenerator::ProgressStep() {
 
 bool HeapSnapshotGenerator::ProgressReport(bool force) {
   const int kProgressReportGranularity = 10000;
+  if (snapshot_->edge_stream() != nullptr &&
+      snapshot_->edge_stream()->aborted()) {
+    return false;
+  }
   if (control_ != nullptr &&
       (force || progress_counter_ % kProgressReportGranularity == 0)) {
     return control_->ReportProgressValue(progress_counter_, progress_total_) ==
@@ -3845,4 +3859,140 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+HeapSnapshotBinarySerializer::HeapSnapshotBinarySerializer(
+    HeapSnapshot* snapshot, v8::OutputStream* stream)
+    : snapshot_(snapshot),
+      writer_(std::make_unique<OutputStreamWriter>(stream)),
+      strings_(StringsMatch) {}
+
+HeapSnapshotBinarySerializer::~HeapSnapshotBinarySerializer() {
+  DCHECK_NE(snapshot_->edge_stream(), this);
+}
+
+bool HeapSnapshotBinarySerializer::aborted() const {
+  return writer_->aborted();
+}
+
+void HeapSnapshotBinarySerializer::Serialize() {
+  DCHECK(snapshot_->is_complete());
+  WriteHeader();
+  WriteNodes();
+  for (const HeapGraphEdge& edge : snapshot_->edges()) {
+    if (edge.type() == HeapGraphEdge::kElement ||
+        edge.type() == HeapGraphEdge::kHidden) {
+      WriteIndexedEdge(edge.type(), edge.index(), edge.from(), edge.to());
+    } else {
+      WriteNamedEdge(edge.type(), edge.name(), edge.from(), edge.to());
+    }
+    if (aborted()) return;
+  }
+  WriteLocations();
+  WriteEnd();
+}
+
+void HeapSnapshotBinarySerializer::StartStreaming() {
+  DCHECK_NULL(snapshot_->edge_stream());
+  DCHECK(snapshot_->entries().empty());
+  snapshot_->set_edge_stream(this);
+  WriteHeader();
+}
+
+bool HeapSnapshotBinarySerializer::FinishStreaming() {
+  DCHECK_EQ(snapshot_->edge_stream(), this);
+  snapshot_->set_edge_stream(nullptr);
+  if (aborted()) return false;
+  WriteNodes();
+  WriteLocations();
+  WriteEnd();
+  return !aborted();
+}
+
+void HeapSnapshotBinarySerializer::WriteNamedEdge(HeapGraphEdge::Type type,
+                                                  const char* name,
+                                                  const HeapEntry* from,
+                                                  const HeapEntry* to) {
+  // The string record has to precede the edge record that refers to it.
+  WriteEdge(type, GetStringId(name), from, to);
+}
+
+void HeapSnapshotBinarySerializer::WriteIndexedEdge(HeapGraphEdge::Type type,
+                                                    int index,
+                                                    const HeapEntry* from,
+                                                    const HeapEntry* to) {
+  DCHECK_GE(index, 0);
+  WriteEdge(type, static_cast<uint32_t>(index), from, to);
+}
+
+void HeapSnapshotBinarySerializer::WriteEdge(HeapGraphEdge::Type type,
+                                             uint32_t name_or_index,
+                                             const HeapEntry* from,
+                                             const HeapEntry* to) {
+  WriteVarint(static_cast<uint8_t>(RecordTag::kEdge));
+  WriteVarint(from->index());
+  WriteVarint(static_cast<uint8_t>(type));
+  WriteVarint(name_or_index);
+  WriteVarint(to->index());
+}
+
+uint32_t HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  int length = static_cast<int>(strlen(s));
+  base::HashMap::Entry* cache_entry = strings_.LookupOrInsert(
+      const_cast<char*>(s),
+      StringHasher::HashSequentialString(s, length, HashSeed::Default()));
+  if (cache_entry->value == nullptr) {
+    cache_entry->value =
+        reinterpret_cast<void*>(static_cast<uintptr_t>(++next_string_id_));
+    WriteVarint(static_cast<uint8_t>(RecordTag::kString));
+    WriteVarint(length);
+    writer_->AddString(s);
+  }
+  // Ids start at 0, so the map stores them biased by one.
+  return static_cast<uint32_t>(
+      reinterpret_cast<uintptr_t>(cache_entry->value) - 1);
+}
+
+void HeapSnapshotBinarySerializer::WriteVarint(uint64_t value) {
+  while (value >= 0x80) {
+    writer_->AddByte(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  writer_->AddByte(static_cast<uint8_t>(value));
+}
+
+void HeapSnapshotBinarySerializer::WriteHeader() {
+  writer_->AddString("V8HS");
+  WriteVarint(kFormatVersion);
+}
+
+void HeapSnapshotBinarySerializer::WriteNodes() {
+  DCHECK_EQ(0, snapshot_->root()->index());
+  for (const HeapEntry& entry : snapshot_->entries()) {
+    uint32_t name_id = GetStringId(entry.name());
+    WriteVarint(static_cast<uint8_t>(RecordTag::kNode));
+    WriteVarint(static_cast<uint8_t>(entry.type()));
+    WriteVarint(name_id);
+    WriteVarint(entry.id());
+    WriteVarint(entry.self_size());
+    WriteVarint(entry.trace_node_id());
+    WriteVarint(entry.detachedness());
+    if (aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::WriteLocations() {
+  for (const EntrySourceLocation& location : snapshot_->locations()) {
+    WriteVarint(static_cast<uint8_t>(RecordTag::kLocation));
+    WriteVarint(location.entry_index);
+    WriteVarint(static_cast<uint32_t>(location.scriptId));
+    WriteVarint(static_cast<uint32_t>(location.line));
+    WriteVarint(static_cast<uint32_t>(location.col));
+    if (aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::WriteEnd() {
+  WriteVarint(static_cast<uint8_t>(RecordTag::kEnd));
+  writer_->Finalize();
+}
+
 }  // namespace v8::internal
@@ -38,6 +38,7 @@ class AllocationTraceNode;
 class HeapEntry;
 class HeapProfiler;
 class HeapSnapshot;
+class HeapSnapshotBinarySerializer;
 class HeapSnapshotGenerator;
 class IsolateSafepointScope;
 class JSArrayBuffer;
@@ -258,6 +259,12 @@ class HeapSnapshot {
   }
   size_t extra_native_bytes() const { return extra_native_bytes_; }
   void set_extra_native_bytes(size_t bytes) { extra_native_bytes_ = bytes; }
+  // When set, edges are handed to the serializer as they are added instead
+  // of being stored, and the snapshot never becomes complete.
+  HeapSnapshotBinarySerializer* edge_stream() const { return edge_stream_; }
+  void set_edge_stream(HeapSnapshotBinarySerializer* stream) {
+    edge_stream_ = stream;
+  }
 
   void AddLocation(HeapEntry* entry, int scriptId, int line, int col);
   HeapEntry* AddEntry(HeapEntry::Type type,
@@ -295,6 +302,7 @@ class HeapSnapshot {
   v8::HeapProfiler::HeapSnapshotMode snapshot_mode_;
   v8::HeapProfiler::NumericsMode numerics_mode_;
   size_t extra_native_bytes_ = 0;
+  HeapSnapshotBinarySerializer* edge_stream_ = nullptr;
 
   // The ScriptsLineEndsMap instance stores the line ends of scripts that did
   // not get their line_ends() information populated in heap.
@@ -806,6 +814,64 @@ class HeapSnapshotJSONSerializer {
   friend class HeapSnapshotJSONSerializerIterator;
 };
 
+// Writes a snapshot in the v8::HeapSnapshot::kBinary format. Either
+// serializes a complete snapshot, or is attached to a snapshot that is being
+// generated so that edges are written out as they are discovered.
+class HeapSnapshotBinarySerializer {
+ public:
+  HeapSnapshotBinarySerializer(HeapSnapshot* snapshot,
+                               v8::OutputStream* stream);
+  ~HeapSnapshotBinarySerializer();
+  HeapSnapshotBinarySerializer(const HeapSnapshotBinarySerializer&) = delete;
+  HeapSnapshotBinarySerializer& operator=(
+      const HeapSnapshotBinarySerializer&) = delete;
+
+  void Serialize();
+
+  // Attaches to the snapshot before generation starts. FinishStreaming()
+  // detaches again and writes the nodes, which are only final once
+  // generation is done. Returns false if the stream aborted.
+  void StartStreaming();
+  bool FinishStreaming();
+
+  void WriteNamedEdge(HeapGraphEdge::Type type, const char* name,
+                      const HeapEntry* from, const HeapEntry* to);
+  void WriteIndexedEdge(HeapGraphEdge::Type type, int index,
+                        const HeapEntry* from, const HeapEntry* to);
+
+  bool aborted() const;
+
+ private:
+  enum class RecordTag : uint8_t {
+    kEnd = 0,
+    kString = 1,
+    kEdge = 2,
+    kNode = 3,
+    kLocation = 4,
+  };
+
+  static constexpr uint32_t kFormatVersion = 1;
+
+  V8_INLINE static bool StringsMatch(void* key1, void* key2) {
+    return strcmp(reinterpret_cast<char*>(key1),
+                  reinterpret_cast<char*>(key2)) == 0;
+  }
+
+  uint32_t GetStringId(const char* s);
+  void WriteVarint(uint64_t value);
+  void WriteHeader();
+  void WriteEdge(HeapGraphEdge::Type type, uint32_t name_or_index,
+                 const HeapEntry* from, const HeapEntry* to);
+  void WriteNodes();
+  void WriteLocations();
+  void WriteEnd();
+
+  HeapSnapshot* snapshot_;
+  std::unique_ptr<OutputStreamWriter> writer_;
+  base::CustomMatcherHashMap strings_;
+  uint32_t next_string_id_ = 0;
+};
+
 }  // namespace v8::internal
 
 #endif  // V8_PROFILER_HEAP_SNAPSHOT_GENERATOR_H_
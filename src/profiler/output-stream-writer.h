@@ -36,6 +36,12 @@ class OutputStreamWriter {
     chunk_[chunk_pos_++] = c;
     MaybeWriteChunk();
   }
+  // Unlike AddCharacter, accepts any byte value, for binary formats.
+  void AddByte(uint8_t b) {
+    DCHECK(chunk_pos_ < chunk_size_);
+    chunk_[chunk_pos_++] = static_cast<char>(b);
+    MaybeWriteChunk();
+  }
   void AddString(const char* s) {
     size_t len = strlen(s);
     DCHECK_GE(kMaxInt, len);
@@ -1243,5 +1243,13 @@ void CpuProfilesCollection::UpdateNativeContextAddressForCurrentProfiles(
   }
 }
 
+void CpuProfilesCollection::AddDroppedSamplesToCurrentProfiles(
+    unsigned count) {
+  base::RecursiveMutexGuard profiles_guard{&current_profiles_mutex_};
+  for (const std::unique_ptr<CpuProfile>& profile : current_profiles_) {
+    profile->add_dropped_samples(static_cast<int>(count));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -449,6 +449,8 @@ class CpuProfile {
 
   int samples_count() const { return static_cast<int>(samples_.size()); }
   const SampleInfo& sample(int index) const { return samples_[index]; }
+  int dropped_samples_count() const { return dropped_samples_count_; }
+  void add_dropped_samples(int count) { dropped_samples_count_ += count; }
 
   int64_t sampling_interval_us() const {
     return options_.sampling_interval_us();
@@ -481,6 +483,8 @@ class CpuProfile {
   // Number of microseconds worth of profiler ticks that should elapse before
   // the next sample is recorded.
   base::TimeDelta next_sample_delta_;
+  // Samples lost because the tick buffer of the profiler was full.
+  int dropped_samples_count_ = 0;
 };
 
 class CpuProfileMaxSamplesCallbackTask : public v8::Task {
@@ -593,6 +597,9 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   // Called from profile generator thread.
   void UpdateNativeContextAddressForCurrentProfiles(Address from, Address to);
 
+  // Called from profile generator thread.
+  void AddDroppedSamplesToCurrentProfiles(unsigned count);
+
   // Limits the number of profiles that can be simultaneously collected.
   static const int kMaxSimultaneousProfiles = 100;
 
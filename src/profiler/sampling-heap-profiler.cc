@@ -113,6 +113,12 @@ void SamplingHeapProfiler::OnWeakCallback(
              v8::HeapProfiler::kSamplingIncludeObjectsCollectedByMinorGC)
           : (sample->profiler->flags_ &
              v8::HeapProfiler::kSamplingIncludeObjectsCollectedByMajorGC);
+  sample->collection_gc_count = heap->gc_count();
+  SamplingHeapProfiler* profiler = sample->profiler;
+  if (profiler->reports_deltas_ &&
+      sample->sample_id <= profiler->last_delta_sample_id_) {
+    profiler->collected_since_delta_.push_back(profiler->BuildSample(sample));
+  }
   if (should_keep_sample) {
     sample->global.Reset();
     return;
@@ -285,6 +291,18 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
 }
 
 v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
+  AllocationProfile* profile = TranslateProfile();
+  profile->samples_ = BuildSamples();
+  return profile;
+}
+
+v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfileDelta() {
+  AllocationProfile* profile = TranslateProfile();
+  profile->samples_ = BuildDeltaSamples();
+  return profile;
+}
+
+AllocationProfile* SamplingHeapProfiler::TranslateProfile() {
   if (flags_ & v8::HeapProfiler::kSamplingForceGC) {
     isolate_->heap()->CollectAllGarbage(
         GCFlag::kNoFlags, GarbageCollectionReason::kSamplingProfiler);
@@ -301,21 +319,47 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
   }
   auto profile = new v8::internal::AllocationProfile();
   TranslateAllocationNode(profile, &profile_root_, scripts);
-  profile->samples_ = BuildSamples();
-
   return profile;
 }
 
+v8::AllocationProfile::Sample SamplingHeapProfiler::BuildSample(
+    const Sample* sample) const {
+  // The GC that collected the object does not count as survived.
+  bool is_live = sample->collection_gc_count == 0;
+  unsigned int survived_gcs =
+      is_live ? heap_->gc_count() - sample->allocation_gc_count
+              : sample->collection_gc_count - sample->allocation_gc_count - 1;
+  return v8::AllocationProfile::Sample{sample->owner->id_,
+                                       sample->size,
+                                       ScaleSample(sample->size, 1).count,
+                                       sample->sample_id,
+                                       survived_gcs,
+                                       is_live};
+}
+
 const std::vector<v8::AllocationProfile::Sample>
 SamplingHeapProfiler::BuildSamples() const {
   std::vector<v8::AllocationProfile::Sample> samples;
   samples.reserve(samples_.size());
+  for (const auto& it : samples_) {
+    samples.push_back(BuildSample(it.second.get()));
+  }
+  return samples;
+}
+
+const std::vector<v8::AllocationProfile::Sample>
+SamplingHeapProfiler::BuildDeltaSamples() {
+  std::vector<v8::AllocationProfile::Sample> samples =
+      std::move(collected_since_delta_);
+  collected_since_delta_.clear();
   for (const auto& it : samples_) {
     const Sample* sample = it.second.get();
-    samples.emplace_back(v8::AllocationProfile::Sample{
-        sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+    if (sample->sample_id > last_delta_sample_id_) {
+      samples.push_back(BuildSample(sample));
+    }
   }
+  reports_deltas_ = true;
+  last_delta_sample_id_ = last_sample_id_;
   return samples;
 }
 
@@ -106,7 +106,8 @@ class SamplingHeapProfiler {
           owner(owner_),
           global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          allocation_gc_count(profiler_->heap_->gc_count()) {}
     Sample(const Sample&) = delete;
     Sample& operator=(const Sample&) = delete;
     const size_t size;
@@ -114,6 +115,10 @@ class SamplingHeapProfiler {
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    const unsigned int allocation_gc_count;
+    // Set when the object is collected, to the count including the collecting
+    // GC.
+    unsigned int collection_gc_count = 0;
   };
 
   SamplingHeapProfiler(Heap* heap, StringsStorage* names, uint64_t rate,
@@ -123,6 +128,7 @@ class SamplingHeapProfiler {
   SamplingHeapProfiler& operator=(const SamplingHeapProfiler&) = delete;
 
   v8::AllocationProfile* GetAllocationProfile();
+  v8::AllocationProfile* GetAllocationProfileDelta();
   StringsStorage* names() const { return names_; }
 
  private:
@@ -160,7 +166,10 @@ class SamplingHeapProfiler {
 
   void SampleObject(Address soon_object, size_t size);
 
+  AllocationProfile* TranslateProfile();
+  v8::AllocationProfile::Sample BuildSample(const Sample* sample) const;
   const std::vector<v8::AllocationProfile::Sample> BuildSamples() const;
+  const std::vector<v8::AllocationProfile::Sample> BuildDeltaSamples();
 
   AllocationNode* FindOrAddChildNode(AllocationNode* parent, const char* name,
                                      int script_id, int start_position);
@@ -191,6 +200,11 @@ class SamplingHeapProfiler {
   StringsStorage* const names_;
   AllocationNode profile_root_;
   std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+  // Samples up to this id have been reported by GetAllocationProfileDelta(),
+  // which also collects the ones among them that die until its next call.
+  bool reports_deltas_ = false;
+  uint64_t last_delta_sample_id_ = 0;
+  std::vector<v8::AllocationProfile::Sample> collected_since_delta_;
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
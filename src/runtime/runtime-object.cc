@@ -12,6 +12,7 @@
 #include "src/execution/messages.h"
 #include "src/handles/maybe-handles.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/map-updater.h"
 #include "src/objects/property-descriptor-object.h"
 #include "src/objects/property-descriptor.h"
@@ -879,9 +880,15 @@ RUNTIME_FUNCTION(Runtime_NewObject) {
   DCHECK_EQ(2, args.length());
   DirectHandle<JSFunction> target = args.at<JSFunction>(0);
   DirectHandle<JSReceiver> new_target = args.at<JSReceiver>(1);
-  RETURN_RESULT_OR_FAILURE(
-      isolate,
-      JSObject::New(target, new_target, Handle<AllocationSite>::null()));
+  DirectHandle<AllocationSite> site;
+  if (*target == *new_target && target->has_feedback_vector()) {
+    Tagged<Object> maybe_site =
+        target->feedback_vector()->constructor_allocation_site(kAcquireLoad);
+    if (IsAllocationSite(maybe_site)) {
+      site = direct_handle(Cast<AllocationSite>(maybe_site), isolate);
+    }
+  }
+  RETURN_RESULT_OR_FAILURE(isolate, JSObject::New(target, new_target, site));
 }
 
 RUNTIME_FUNCTION(Runtime_GetDerivedMap) {
@@ -13,6 +13,7 @@
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/background-merge-task.h"
 #include "src/common/globals.h"
+#include "src/execution/tiering-manager.h"
 #include "src/handles/maybe-handles.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
@@ -118,6 +119,18 @@ AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
   return data.GetScriptData();
 }
 
+namespace {
+
+// Whether a tiering decision must be reset to kEarlySparkplug before it is
+// written to the code cache.
+bool ClampCachedTieringDecision(CachedTieringDecision decision) {
+  if (decision <= CachedTieringDecision::kEarlySparkplug) return false;
+  return !v8_flags.code_cache_tiering_decisions ||
+         decision != CachedTieringDecision::kDelayMaglev;
+}
+
+}  // namespace
+
 void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
                                          SlotType slot_type) {
   ReadOnlyRoots roots(isolate());
@@ -189,9 +202,14 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
               debug_info->OriginalBytecodeArray(isolate()), isolate());
         }
       }
+      // Decisions to tier up early are clamped to kEarlySparkplug, since
+      // the feedback that justified them is not part of the cache. With
+      // --code-cache-tiering-decisions, kDelayMaglev is kept so that
+      // functions which deoptimized in a previous run wait for more
+      // feedback again before reaching Maglev.
       if (v8_flags.profile_guided_optimization) {
         cached_tiering_decision = sfi->cached_tiering_decision();
-        if (cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
+        if (ClampCachedTieringDecision(cached_tiering_decision)) {
           sfi->set_cached_tiering_decision(
               CachedTieringDecision::kEarlySparkplug);
         }
@@ -205,7 +223,7 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
                                   isolate());
     }
     if (v8_flags.profile_guided_optimization &&
-        cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
+        ClampCachedTieringDecision(cached_tiering_decision)) {
       sfi->set_cached_tiering_decision(cached_tiering_decision);
     }
     return;
@@ -395,6 +413,14 @@ void FinalizeDeserialization(Isolate* isolate,
     SetScriptFieldsFromDetails(isolate, *script, script_details, &no_gc);
   }
 
+  if (V8_UNLIKELY(v8_flags.tiering_profile)) {
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      isolate->tiering_manager()->NotifyCompiled(info);
+    }
+  }
+
   bool needs_source_positions = isolate->NeedsSourcePositions();
   if (!log_code_creation && !needs_source_positions) return;
 
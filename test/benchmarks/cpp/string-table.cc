@@ -0,0 +1,110 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures internalization throughput of several isolates sharing one string
+// table, one isolate per benchmark thread. V8 flags are taken from the command
+// line, e.g. to compare insertion with and without the table's write lock:
+//
+//   string_table_benchmark --concurrent-string-table-insertion
+
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate-inl.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+constexpr int kKeysPerIteration = 1024;
+constexpr int kMaxThreads = 32;
+
+v8::ArrayBuffer::Allocator* array_buffer_allocator;
+
+// Internalizes fresh keys on every iteration, so that most lookups miss and
+// insert into the table. With `shared_keys` all threads internalize the same
+// sequence of keys and race to insert them, as workers parsing JSON with the
+// same property names do.
+void InternalizeKeys(benchmark::State& state, bool shared_keys) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = array_buffer_allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    const int prefix = shared_keys ? 0 : state.thread_index() + 1;
+    uint64_t round = 0;
+    char key[64];
+    for (auto _ : state) {
+      v8::HandleScope handle_scope(isolate);
+      for (int i = 0; i < kKeysPerIteration; i++) {
+        const int length = std::snprintf(key, sizeof(key),
+                                         "key-%d-%" PRIu64 "-%d", prefix,
+                                         round, i);
+        benchmark::DoNotOptimize(v8::String::NewFromUtf8(
+            isolate, key, v8::NewStringType::kInternalized, length));
+      }
+      round++;
+    }
+  }
+  isolate->Dispose();
+  state.SetItemsProcessed(state.iterations() * kKeysPerIteration);
+}
+
+void BM_InternalizeDistinctKeys(benchmark::State& state) {
+  InternalizeKeys(state, false);
+}
+
+void BM_InternalizeSameKeys(benchmark::State& state) {
+  InternalizeKeys(state, true);
+}
+
+BENCHMARK(BM_InternalizeDistinctKeys)
+    ->ThreadRange(1, kMaxThreads)
+    ->UseRealTime();
+BENCHMARK(BM_InternalizeSameKeys)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  v8::V8::SetFlagsFromString("--shared-string-table");
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+  array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+
+  // The first isolate owns the shared heap and has to outlive the isolates of
+  // the benchmark threads. It stays parked so that it does not hold up shared
+  // garbage collections.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = array_buffer_allocator;
+  v8::Isolate* shared_space_isolate = v8::Isolate::New(create_params);
+  {
+    v8::internal::Isolate* i_isolate =
+        reinterpret_cast<v8::internal::Isolate*>(shared_space_isolate);
+    i_isolate->main_thread_local_isolate()->ExecuteMainThreadWhileParked(
+        [&argc, argv]() {
+          ::benchmark::Initialize(&argc, argv);
+          if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return;
+          ::benchmark::RunSpecifiedBenchmarks();
+          ::benchmark::Shutdown();
+        });
+  }
+  shared_space_isolate->Dispose();
+
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  delete array_buffer_allocator;
+  return 0;
+}
@@ -13,11 +13,15 @@
 #define HEAP_TEST_METHODS(V)                                \
   V(CodeLargeObjectSpace)                                   \
   V(CodeLargeObjectSpace64k)                                \
+  V(CompactOnEveryFullGCIgnoresBudget)                      \
+  V(CompactionBudgetIsSharedAcrossSpaces)                   \
   V(CompactionFullAbortedPage)                              \
   V(CompactionPartiallyAbortedPage)                         \
   V(CompactionPartiallyAbortedPageIntraAbortedPointers)     \
   V(CompactionPartiallyAbortedPageWithInvalidatedSlots)     \
   V(CompactionPartiallyAbortedPageWithRememberedSetEntries) \
+  V(CompactionPauseTargetBoundsCandidates)                  \
+  V(CompactionPauseTargetClampsEmbedderTarget)              \
   V(CompactionSpaceDivideMultiplePages)                     \
   V(CompactionSpaceDivideSinglePage)                        \
   V(InvalidatedSlotsAfterTrimming)                          \
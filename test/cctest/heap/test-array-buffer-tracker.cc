@@ -2,7 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
+#include <memory>
+
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -430,6 +434,115 @@ TEST(ArrayBuffer_ExternalBackingStoreSizeIncreasesMarkCompact) {
   CHECK_EQ(0, backing_store_after - backing_store_before);
 }
 
+namespace {
+
+// Counts deallocations of large buffers by the thread that performed them.
+class ThreadRecordingAllocator final : public v8::ArrayBuffer::Allocator {
+ public:
+  explicit ThreadRecordingAllocator(size_t large_size)
+      : large_size_(large_size),
+        main_thread_id_(base::OS::GetCurrentThreadId()),
+        allocator_(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {}
+
+  void* Allocate(size_t length) override {
+    return allocator_->Allocate(length);
+  }
+  void* AllocateUninitialized(size_t length) override {
+    return allocator_->AllocateUninitialized(length);
+  }
+  void Free(void* data, size_t length) override {
+    if (length >= large_size_) {
+      if (base::OS::GetCurrentThreadId() == main_thread_id_) {
+        main_thread_frees_++;
+      } else {
+        background_frees_++;
+      }
+    }
+    allocator_->Free(data, length);
+  }
+
+  int main_thread_frees() const { return main_thread_frees_; }
+  int background_frees() const { return background_frees_; }
+
+ private:
+  const size_t large_size_;
+  const int main_thread_id_;
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  std::atomic<int> main_thread_frees_{0};
+  std::atomic<int> background_frees_{0};
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(ArrayBuffer_BackgroundRelease) {
+  ManualGCScope manual_gc_scope;
+  v8_flags.background_array_buffer_release = true;
+  // Sweep on the main thread, which is the case the releaser is for.
+  v8_flags.concurrent_array_buffer_sweeping = false;
+  const size_t kArrayBufferSize =
+      2 * v8_flags.background_array_buffer_release_min_size;
+  ThreadRecordingAllocator allocator(kArrayBufferSize);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = i_isolate->heap();
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+    {
+      v8::HandleScope inner_handle_scope(isolate);
+      Local<v8::ArrayBuffer> detached =
+          v8::ArrayBuffer::New(isolate, kArrayBufferSize);
+      detached->Detach(v8::Local<v8::Value>()).Check();
+      Local<v8::ArrayBuffer> dead =
+          v8::ArrayBuffer::New(isolate, kArrayBufferSize);
+      USE(dead);
+    }
+    heap::InvokeAtomicMajorGC(heap);
+    while (heap->array_buffer_sweeper()->PendingReleaseBytes() > 0) {
+      base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+    }
+    CHECK_EQ(0, allocator.main_thread_frees());
+    CHECK_EQ(2, allocator.background_frees());
+  }
+  isolate->Dispose();
+}
+
+UNINITIALIZED_TEST(ArrayBuffer_NoBackgroundReleaseWhenReducingMemory) {
+  ManualGCScope manual_gc_scope;
+  v8_flags.background_array_buffer_release = true;
+  v8_flags.concurrent_array_buffer_sweeping = false;
+  const size_t kArrayBufferSize =
+      2 * v8_flags.background_array_buffer_release_min_size;
+  ThreadRecordingAllocator allocator(kArrayBufferSize);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = i_isolate->heap();
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+    {
+      v8::HandleScope inner_handle_scope(isolate);
+      Local<v8::ArrayBuffer> dead =
+          v8::ArrayBuffer::New(isolate, kArrayBufferSize);
+      USE(dead);
+    }
+    // Memory-reducing GCs free large backing stores before they finish.
+    heap::InvokeMemoryReducingMajorGCs(heap);
+    CHECK_EQ(0u, heap->array_buffer_sweeper()->PendingReleaseBytes());
+    CHECK_EQ(1, allocator.main_thread_frees());
+    CHECK_EQ(0, allocator.background_frees());
+  }
+  isolate->Dispose();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
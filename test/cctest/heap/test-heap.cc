@@ -61,6 +61,7 @@
 #include "src/heap/memory-reducer.h"
 #include "src/heap/mutable-page-metadata.h"
 #include "src/heap/parked-scope.h"
+#include "src/heap/pretenuring-handler-inl.h"
 #include "src/heap/remembered-set-inl.h"
 #include "src/heap/safepoint.h"
 #include "src/ic/ic.h"
@@ -2859,6 +2860,89 @@ TEST(OptimizedPretenuringObjectArrayLiterals) {
   CHECK(CcTest::heap()->InOldSpace(*o));
 }
 
+TEST(OptimizedPretenuringConstructorInstances) {
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.expose_gc = true;
+  v8_flags.constructor_allocation_site_pretenuring = true;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer()) return;
+  if (v8_flags.gc_global || v8_flags.stress_compaction ||
+      v8_flags.stress_incremental_marking || v8_flags.single_generation ||
+      v8_flags.stress_concurrent_allocation) {
+    return;
+  }
+  v8::HandleScope scope(CcTest::isolate());
+  ManualGCScope manual_gc_scope;
+  GrowNewSpaceToMaximumCapacity(CcTest::heap());
+
+  base::ScopedVector<char> source(1024);
+  base::SNPrintF(source,
+                 "var number_elements = %d;"
+                 "var elements = new Array(number_elements);"
+                 "function Foo(i) {"
+                 "  this.a = i;"
+                 "  this.b = {};"
+                 "}"
+                 "function f() {"
+                 "  for (var i = 0; i < number_elements; i++) {"
+                 "    elements[i] = new Foo(i);"
+                 "  }"
+                 "  return elements[number_elements - 1];"
+                 "};"
+                 "%%EnsureFeedbackVectorForFunction(Foo);"
+                 "%%PrepareFunctionForOptimization(f);"
+                 "f(); gc();"
+                 "f(); f();"
+                 "%%OptimizeFunctionOnNextCall(f);"
+                 "f();",
+                 kPretenureCreationCount);
+
+  v8::Local<v8::Value> res = CompileRun(source.begin());
+
+  i::DirectHandle<JSObject> o = Cast<JSObject>(
+      v8::Utils::OpenDirectHandle(*v8::Local<v8::Object>::Cast(res)));
+  CHECK(IsAllocationSite(
+      Cast<JSFunction>(o->map()->GetConstructor())
+          ->feedback_vector()
+          ->constructor_allocation_site(kAcquireLoad)));
+
+  CHECK(CcTest::heap()->InOldSpace(*o));
+  // The object stored into the instance follows it into old space.
+  FieldIndex idx = FieldIndex::ForPropertyIndex(o->map(), 1);
+  CHECK(CcTest::heap()->InOldSpace(o->RawFastPropertyAt(idx)));
+}
+
+TEST(ConstructorAllocationSiteMementos) {
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.constructor_allocation_site_pretenuring = true;
+  CcTest::InitializeVM();
+  if (!V8_ALLOCATION_SITE_TRACKING_BOOL || v8_flags.single_generation) return;
+  v8::HandleScope scope(CcTest::isolate());
+  ManualGCScope manual_gc_scope;
+  Heap* heap = CcTest::heap();
+
+  CompileRun(
+      "function Foo() { this.a = 1; }"
+      "class Bar extends Foo {}"
+      "%EnsureFeedbackVectorForFunction(Foo);"
+      "%EnsureFeedbackVectorForFunction(Bar);"
+      "new Foo(); new Bar();");
+  auto has_memento = [heap](const char* source) {
+    DirectHandle<JSObject> o = Cast<JSObject>(
+        v8::Utils::OpenDirectHandle(*v8::Local<v8::Object>::Cast(
+            CompileRun(source))));
+    CHECK(HeapLayout::InYoungGeneration(*o));
+    return !PretenuringHandler::FindAllocationMemento<
+                PretenuringHandler::kForRuntime>(heap, o->map(), *o)
+                .is_null();
+  };
+  // Only instances that the constructor creates for itself use its site, both
+  // in FastNewObject and in Runtime::kNewObject.
+  CHECK(has_memento("new Foo()"));
+  CHECK(!has_memento("new Bar()"));
+  CHECK(!has_memento("Reflect.construct(Foo, [], Bar)"));
+}
+
 TEST(OptimizedPretenuringNestedInObjectProperties) {
   v8_flags.allow_natives_syntax = true;
   v8_flags.expose_gc = true;
@@ -41,6 +41,7 @@
 
 #include "include/v8-locker.h"
 #include "src/handles/global-handles.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/live-object-range-inl.h"
 #include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
@@ -237,6 +238,194 @@ HEAP_TEST(DoNotEvacuatePinnedPages) {
   }
 }
 
+namespace {
+
+// Compaction speed reported to the GC tracer by the compaction tests below.
+constexpr size_t kTestCompactionSpeedInBytesPerMs = MB;
+
+// Fills `holder->length()` fresh old space pages and keeps a single small array
+// alive on each of them. Returns the live bytes of each page.
+size_t CreateFragmentedPages(Heap* heap, ManualGCScope& manual_gc_scope,
+                             DirectHandle<FixedArray> holder) {
+  Isolate* isolate = heap->isolate();
+  for (int i = 0; i < holder->length(); i++) {
+    HandleScope scope(isolate);
+    CHECK(heap->old_space()->TryExpand(heap->main_thread_local_heap(),
+                                       AllocationOrigin::kRuntime));
+    DirectHandleVector<FixedArray> handles(isolate);
+    heap::CreatePadding(
+        heap,
+        static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+        AllocationType::kOld, &handles, 4 * KB);
+    holder->set(i, *handles.front());
+  }
+  {
+    // Free the rest of the pages without compacting them.
+    heap::ManualEvacuationCandidatesSelectionScope no_compaction(
+        manual_gc_scope);
+    heap::InvokeMajorGC(heap);
+    heap->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kV8Only);
+  }
+  size_t live_bytes = 0;
+  for (int i = 0; i < holder->length(); i++) {
+    PageMetadata* page =
+        PageMetadata::FromHeapObject(Cast<HeapObject>(holder->get(i)));
+    CHECK(!page->never_evacuate());
+    live_bytes = std::max(live_bytes, page->allocated_bytes());
+  }
+  return live_bytes;
+}
+
+void ReportCompactionSpeed(Heap* heap) {
+  heap->tracer()->ResetForTesting();
+  heap->tracer()->AddCompactionEvent(1.0, kTestCompactionSpeedInBytesPerMs);
+}
+
+size_t LiveBytesOfCandidates(const std::vector<PageMetadata*>& candidates) {
+  size_t live_bytes = 0;
+  for (PageMetadata* page : candidates) live_bytes += page->allocated_bytes();
+  return live_bytes;
+}
+
+// Turns the selected candidates back into regular pages. Their free memory is
+// reclaimed by the next sweep.
+void ClearEvacuationCandidates(std::vector<PageMetadata*>& candidates) {
+  for (PageMetadata* page : candidates) {
+    page->AbortEvacuation();
+    page->ClearEvacuationCandidate();
+  }
+  candidates.clear();
+}
+
+}  // namespace
+
+HEAP_TEST(CompactionPauseTargetBoundsCandidates) {
+  if (!v8_flags.compact) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  DirectHandle<FixedArray> holder =
+      isolate->factory()->NewFixedArray(6, AllocationType::kOld);
+  heap::SealCurrentObjects(heap);
+  const size_t live_bytes =
+      CreateFragmentedPages(heap, manual_gc_scope, holder);
+
+  // Leave room for two and a half of the fragmented pages.
+  v8_flags.compaction_pause_target_ms =
+      2.5 * live_bytes / kTestCompactionSpeedInBytesPerMs;
+  ReportCompactionSpeed(heap);
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  collector->evacuation_budget_ = collector->ComputeEvacuationBudget();
+  CHECK(collector->evacuation_budget_.has_value());
+  const size_t budget = *collector->evacuation_budget_;
+  CHECK_GE(budget, 2 * live_bytes);
+  CHECK_LT(budget, 3 * live_bytes);
+
+  collector->CollectEvacuationCandidates(heap->old_space());
+  std::vector<PageMetadata*>& candidates = collector->evacuation_candidates_;
+  CHECK_GE(candidates.size(), 1u);
+  CHECK_LT(candidates.size(), static_cast<size_t>(holder->length()));
+  CHECK_LE(LiveBytesOfCandidates(candidates), budget);
+  // Selection stopped because the budget was used up, and the rest of the
+  // budget is left for the other spaces.
+  CHECK_LT(*collector->evacuation_budget_, live_bytes);
+  CHECK_EQ(budget - LiveBytesOfCandidates(candidates),
+           *collector->evacuation_budget_);
+
+  ClearEvacuationCandidates(candidates);
+  collector->evacuation_budget_.reset();
+  heap::InvokeMajorGC(heap);
+}
+
+HEAP_TEST(CompactionBudgetIsSharedAcrossSpaces) {
+  if (!v8_flags.compact) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  DirectHandle<FixedArray> holder =
+      isolate->factory()->NewFixedArray(6, AllocationType::kOld);
+  heap::SealCurrentObjects(heap);
+  const size_t live_bytes =
+      CreateFragmentedPages(heap, manual_gc_scope, holder);
+  v8_flags.compaction_pause_target_ms =
+      2.5 * live_bytes / kTestCompactionSpeedInBytesPerMs;
+  ReportCompactionSpeed(heap);
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+
+  // The fragmented pages are selected with a fresh budget...
+  collector->evacuation_budget_ = collector->ComputeEvacuationBudget();
+  collector->CollectEvacuationCandidates(heap->old_space());
+  CHECK(!collector->evacuation_candidates_.empty());
+  ClearEvacuationCandidates(collector->evacuation_candidates_);
+
+  // ...but not once spaces compacted before have used the budget up.
+  collector->evacuation_budget_ = live_bytes / 2;
+  collector->CollectEvacuationCandidates(heap->old_space());
+  CHECK(collector->evacuation_candidates_.empty());
+  CHECK_EQ(live_bytes / 2, *collector->evacuation_budget_);
+  collector->evacuation_budget_.reset();
+  heap::InvokeMajorGC(heap);
+}
+
+HEAP_TEST(CompactOnEveryFullGCIgnoresBudget) {
+  if (!v8_flags.compact) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  DirectHandle<FixedArray> holder =
+      isolate->factory()->NewFixedArray(6, AllocationType::kOld);
+  heap::SealCurrentObjects(heap);
+  const size_t live_bytes =
+      CreateFragmentedPages(heap, manual_gc_scope, holder);
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+
+  // --compact-on-every-full-gc selects all pages regardless of the budget and
+  // leaves it untouched for the other spaces.
+  v8_flags.compact_on_every_full_gc = true;
+  collector->evacuation_budget_ = live_bytes / 2;
+  collector->CollectEvacuationCandidates(heap->old_space());
+  CHECK_GE(collector->evacuation_candidates_.size(),
+           static_cast<size_t>(holder->length()));
+  CHECK_EQ(live_bytes / 2, *collector->evacuation_budget_);
+
+  ClearEvacuationCandidates(collector->evacuation_candidates_);
+  collector->evacuation_budget_.reset();
+  v8_flags.compact_on_every_full_gc = false;
+  heap::InvokeMajorGC(heap);
+}
+
+HEAP_TEST(CompactionPauseTargetClampsEmbedderTarget) {
+  if (!v8_flags.compact) return;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::i_isolate()->heap();
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  ReportCompactionSpeed(heap);
+
+  // A pause target that the embedder set never evacuates more than the fixed
+  // quota that applies without a pause target...
+  v8::HeapGrowingTargets targets;
+  targets.max_gc_pause_ms = 1000;
+  heap->SetHeapGrowingTargets(targets);
+  CHECK_EQ(MarkCompactCollector::kMaxEvacuatedBytes,
+           collector->ComputeEvacuationBudget().value());
+  targets.max_gc_pause_ms = 2;
+  heap->SetHeapGrowingTargets(targets);
+  CHECK_EQ(kTestCompactionSpeedInBytesPerMs,
+           collector->ComputeEvacuationBudget().value());
+
+  // ...while an explicit --compaction-pause-target-ms may exceed it.
+  v8_flags.compaction_pause_target_ms = 100;
+  CHECK_EQ(100 * kTestCompactionSpeedInBytesPerMs,
+           collector->ComputeEvacuationBudget().value());
+}
+
 #if defined(__has_feature)
 #if __has_feature(address_sanitizer)
 #define V8_WITH_ASAN 1
@@ -21609,6 +21609,60 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+namespace {
+v8::MaybeLocal<Value> ParseJSONBytes(Local<Context> context,
+                                     std::vector<uint8_t>* bytes) {
+  v8::MaybeLocal<Value> result = v8::JSON::Parse(
+      context, v8::MemorySpan<const uint8_t>(bytes->data(), bytes->size()));
+  // The result must not refer to the caller's bytes.
+  std::fill(bytes->begin(), bytes->end(), 'X');
+  return result;
+}
+}  // namespace
+
+THREADED_TEST(JSONParseBytes) {
+  LocalContext context;
+  v8::Isolate* isolate = context.isolate();
+  HandleScope scope(isolate);
+  Local<Object> global = context->Global();
+
+  std::string ascii =
+      "{\"key\":\"a long string value that is not internalized\","
+      "\"n\":[1,2.5]}";
+  std::vector<uint8_t> bytes(ascii.begin(), ascii.end());
+  Local<Value> obj = ParseJSONBytes(context.local(), &bytes).ToLocalChecked();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("JSON.stringify(obj)", ascii.c_str());
+
+  // U+00E9 and U+20AC encoded as UTF-8.
+  std::string utf8 = "[\"\xC3\xA9\", \"\xE2\x82\xAC\"]";
+  bytes.assign(utf8.begin(), utf8.end());
+  obj = ParseJSONBytes(context.local(), &bytes).ToLocalChecked();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectTrue("obj[0] === '\\u00e9' && obj[1] === '\\u20ac'");
+
+  bytes.clear();
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(ParseJSONBytes(context.local(), &bytes).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+
+  std::string invalid = "[1, 2 x, \"a long string for the error context\"]";
+  bytes.assign(invalid.begin(), invalid.end());
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(ParseJSONBytes(context.local(), &bytes).IsEmpty());
+    CHECK(try_catch.HasCaught());
+    String::Utf8Value message(isolate, try_catch.Message()->Get());
+    CHECK_NOT_NULL(strstr(*message, "[1, 2 x"));
+    String::Utf8Value source(isolate, try_catch.Message()
+                                          ->GetSourceLine(context.local())
+                                          .ToLocalChecked());
+    CHECK_EQ(0, strcmp(*source, invalid.c_str()));
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context.isolate());
@@ -21637,6 +21691,230 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class JSONStringifyTestStream : public v8::OutputStream {
+ public:
+  explicit JSONStringifyTestStream(int chunk_size, int abort_after_chunks = -1)
+      : chunk_size_(chunk_size), abort_after_chunks_(abort_after_chunks) {}
+
+  int GetChunkSize() override { return chunk_size_; }
+  void EndOfStream() override { ++end_of_stream_count_; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK_GT(size, 0);
+    CHECK_LE(size, chunk_size_);
+    if (chunk_count_ == abort_after_chunks_) return kAbort;
+    ++chunk_count_;
+    output_.append(data, size);
+    return kContinue;
+  }
+
+  const std::string& output() const { return output_; }
+  int chunk_count() const { return chunk_count_; }
+  int end_of_stream_count() const { return end_of_stream_count_; }
+
+ private:
+  const int chunk_size_;
+  const int abort_after_chunks_;
+  std::string output_;
+  int chunk_count_ = 0;
+  int end_of_stream_count_ = 0;
+};
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  v8::Isolate* isolate = context.isolate();
+  HandleScope scope(isolate);
+  Local<Value> value = CompileRun(
+      "({a: [1, 2.5, 'x'.repeat(5000), null, true],"
+      "  b: {c: '\\u00e9\\u20ac\\ud83d\\ude00', d: '\\\"\\n'}})");
+  for (Local<String> gap : {Local<String>(), v8_str("  ")}) {
+    Local<String> expected =
+        v8::JSON::Stringify(context.local(), value, gap).ToLocalChecked();
+    v8::String::Utf8Value utf8(isolate, expected);
+    for (int chunk_size : {4, 7, 1024}) {
+      JSONStringifyTestStream stream(chunk_size);
+      CHECK(v8::JSON::Stringify(context.local(), value, &stream, gap)
+                .FromJust());
+      CHECK_EQ(1, stream.end_of_stream_count());
+      CHECK_EQ(std::string(*utf8, utf8.length()), stream.output());
+    }
+  }
+}
+
+THREADED_TEST(JSONStringifyToStreamUndefined) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  JSONStringifyTestStream stream(1024);
+  CHECK(v8::JSON::Stringify(context.local(), v8::Undefined(context.isolate()),
+                            &stream)
+            .FromJust());
+  CHECK_EQ(1, stream.end_of_stream_count());
+  CHECK_EQ(0, stream.chunk_count());
+}
+
+THREADED_TEST(JSONStringifyToStreamAbort) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  Local<Value> value = CompileRun(
+      "var to_json_calls = 0;"
+      "['x'.repeat(100), {toJSON() { to_json_calls++; return 1; }}]");
+  JSONStringifyTestStream stream(16, 1);
+  CHECK(!v8::JSON::Stringify(context.local(), value, &stream).FromJust());
+  CHECK_EQ(0, stream.end_of_stream_count());
+  CHECK_EQ(1, stream.chunk_count());
+  // Serialization stops once the stream aborted.
+  ExpectInt32("to_json_calls", 0);
+}
+
+namespace {
+
+class JSONStringifyGCStream : public JSONStringifyTestStream {
+ public:
+  explicit JSONStringifyGCStream(int chunk_size)
+      : JSONStringifyTestStream(chunk_size) {}
+
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    // Moves the strings that are being stringified.
+    i::heap::InvokeMajorGC(CcTest::heap());
+    return JSONStringifyTestStream::WriteAsciiChunk(data, size);
+  }
+};
+
+}  // namespace
+
+TEST(JSONStringifyToStreamWithGC) {
+  i::ManualGCScope manual_gc_scope;
+  i::FlagScope<bool> compact(&i::v8_flags.compact_on_every_full_gc, true);
+  LocalContext context;
+  v8::Isolate* isolate = context.isolate();
+  HandleScope scope(isolate);
+  Local<Value> value = CompileRun(
+      "[{a: 'x'.repeat(1000), b: '\\u20ac'.repeat(1000)},"
+      " ['y'.repeat(1000), 'z\\u00e9'.repeat(1000)]]");
+  Local<String> expected =
+      v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+  v8::String::Utf8Value utf8(isolate, expected);
+  JSONStringifyGCStream stream(64);
+  CHECK(v8::JSON::Stringify(context.local(), value, &stream).FromJust());
+  CHECK_EQ(1, stream.end_of_stream_count());
+  CHECK_EQ(std::string(*utf8, utf8.length()), stream.output());
+}
+
+THREADED_TEST(JSONStringifyToStreamException) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  Local<Value> value =
+      CompileRun("['x'.repeat(100), {toJSON() { throw new Error(); }}]");
+  v8::TryCatch try_catch(context.isolate());
+  JSONStringifyTestStream stream(16);
+  CHECK(v8::JSON::Stringify(context.local(), value, &stream).IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(0, stream.end_of_stream_count());
+}
+
+namespace {
+
+// Feeds |json| to a JSONIncrementalParser in pieces of |piece_size| bytes.
+// Returns an empty handle if parsing threw.
+Local<Value> ParseJSONIncrementally(Local<Context> context,
+                                    const std::string& json, size_t piece_size,
+                                    size_t byte_budget, int* yields) {
+  v8::JSONIncrementalParser parser(context->GetIsolate());
+  size_t appended = 0;
+  while (true) {
+    v8::Maybe<v8::JSONIncrementalParser::Status> status =
+        parser.Parse(context, 1000, byte_budget);
+    if (status.IsNothing()) return Local<Value>();
+    switch (status.FromJust()) {
+      case v8::JSONIncrementalParser::Status::kYielded:
+        ++*yields;
+        break;
+      case v8::JSONIncrementalParser::Status::kNeedsInput:
+        if (appended == json.size()) {
+          parser.Finish();
+          break;
+        }
+        {
+          size_t length = std::min(piece_size, json.size() - appended);
+          parser.Append(v8::MemorySpan<const uint8_t>(
+              reinterpret_cast<const uint8_t*>(json.data()) + appended,
+              length));
+          appended += length;
+        }
+        break;
+      case v8::JSONIncrementalParser::Status::kDone:
+        CHECK_EQ(appended, json.size());
+        return parser.GetResult();
+    }
+  }
+}
+
+}  // namespace
+
+THREADED_TEST(JSONIncrementalParser) {
+  LocalContext context;
+  v8::Isolate* isolate = context.isolate();
+  HandleScope scope(isolate);
+  // Splits tokens and UTF-8 sequences with one byte pieces.
+  const std::string small_json =
+      "{\"a\": [1, -2.5e3, true, false, null, \"\u00e9\\n\\u20ac\"],\n"
+      " \"__proto__\": {\"b\": {}}, \"0\": [], \"c\": [[[]]]}";
+  // Larger than JsonIncrementalParser::kMaxWholeValueLength, so the outer
+  // objects and the array are built up incrementally.
+  Local<String> large_json =
+      CompileRun(
+          "JSON.stringify({outer: {list: Array.from({length: 5000}, (_, i) =>"
+          "    ({id: i, name: 'r\u00e9cord ' + i, tags: ['x', i / 2, null]})),"
+          "  n: 1}}, null, 1)")
+          .As<String>();
+  v8::String::Utf8Value large_utf8(isolate, large_json);
+  const std::string large(*large_utf8, large_utf8.length());
+  struct {
+    std::string json;
+    size_t piece_size;
+    size_t byte_budget;
+  } cases[] = {
+      {small_json, 1, SIZE_MAX},
+      {small_json, 3, 1},
+      {large, 4096, 1024},
+      {large, 7, SIZE_MAX},
+  };
+  for (const auto& test_case : cases) {
+    int yields = 0;
+    Local<Value> result =
+        ParseJSONIncrementally(context.local(), test_case.json,
+                               test_case.piece_size,
+                               test_case.byte_budget, &yields);
+    CHECK(!result.IsEmpty());
+    if (test_case.byte_budget != SIZE_MAX) CHECK_LT(0, yields);
+    Local<Value> expected =
+        v8::JSON::Parse(context.local(),
+                        v8_str(test_case.json.c_str()))
+            .ToLocalChecked();
+    CHECK(v8::JSON::Stringify(context.local(), result)
+              .ToLocalChecked()
+              ->StrictEquals(v8::JSON::Stringify(context.local(), expected)
+                                 .ToLocalChecked()));
+  }
+}
+
+THREADED_TEST(JSONIncrementalParserSyntaxError) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  for (const char* json :
+       {"[1, 2", "[1 2]", "{\"a\" 1}", "{\"a\": 1,}", "{} x", "\"abc", ""}) {
+    v8::TryCatch try_catch(context.isolate());
+    int yields = 0;
+    CHECK(ParseJSONIncrementally(context.local(), json, 2, SIZE_MAX, &yields)
+              .IsEmpty());
+    CHECK(try_catch.HasCaught());
+    CHECK(try_catch.Exception()->IsNativeError());
+  }
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -22231,6 +22509,36 @@ TEST(RequestInterruptSmallScripts) {
   CHECK(interrupt_was_called);
 }
 
+TEST(RequestInterruptDuringJSONParse) {
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+
+  interrupt_was_called = false;
+  isolate->RequestInterrupt(&SmallScriptsInterruptCallback, nullptr);
+  CHECK(!v8::JSON::Parse(env.local(), v8_str("[1, {\"a\": [2, \"b\"]}]"))
+             .IsEmpty());
+  CHECK(interrupt_was_called);
+}
+
+static void TerminateInterruptCallback(v8::Isolate* isolate, void* data) {
+  isolate->TerminateExecution();
+}
+
+TEST(TerminateExecutionDuringJSONParse) {
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+
+  for (const char* json : {"[1, 2, 3]", "[\"a\", {\"b\": 1}]"}) {
+    v8::TryCatch try_catch(isolate);
+    isolate->RequestInterrupt(&TerminateInterruptCallback, nullptr);
+    CHECK(v8::JSON::Parse(env.local(), v8_str(json)).IsEmpty());
+    CHECK(try_catch.HasTerminated());
+    isolate->CancelTerminateExecution();
+  }
+}
+
 static v8::Global<Value> function_new_expected_env_global;
 static void FunctionNewCallback(const v8::FunctionCallbackInfo<Value>& info) {
   v8::Isolate* isolate = info.GetIsolate();
@@ -1447,6 +1447,196 @@ TEST(HeapSnapshotJSONSerializationAborting) {
 
 namespace {
 
+struct DecodedBinarySnapshot {
+  struct Node {
+    uint32_t type;
+    uint32_t name;
+    uint32_t id;
+    uint64_t self_size;
+  };
+  struct Edge {
+    uint32_t from;
+    uint32_t type;
+    uint32_t name_or_index;
+    uint32_t to;
+  };
+  std::vector<std::string> strings;
+  std::vector<Node> nodes;
+  std::vector<Edge> edges;
+  size_t location_count = 0;
+};
+
+// Decodes the v8::HeapSnapshot::kBinary format and checks that it is well
+// formed.
+DecodedBinarySnapshot DecodeBinarySnapshot(v8::internal::TestJSONStream* s) {
+  v8::base::ScopedVector<char> data(s->size());
+  s->WriteTo(data);
+  size_t pos = 0;
+  auto read_varint = [&]() {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(pos, data.size());
+      uint8_t byte = static_cast<uint8_t>(data[pos++]);
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return value;
+    }
+  };
+  CHECK_GE(data.size(), 4);
+  CHECK_EQ(0, memcmp(data.begin(), "V8HS", 4));
+  pos = 4;
+  CHECK_EQ(1u, read_varint());
+  DecodedBinarySnapshot result;
+  bool done = false;
+  while (!done) {
+    switch (read_varint()) {
+      case 0:
+        done = true;
+        break;
+      case 1: {
+        size_t length = static_cast<size_t>(read_varint());
+        CHECK_LE(pos + length, data.size());
+        result.strings.emplace_back(data.begin() + pos, length);
+        pos += length;
+        break;
+      }
+      case 2: {
+        DecodedBinarySnapshot::Edge edge;
+        edge.from = static_cast<uint32_t>(read_varint());
+        edge.type = static_cast<uint32_t>(read_varint());
+        edge.name_or_index = static_cast<uint32_t>(read_varint());
+        edge.to = static_cast<uint32_t>(read_varint());
+        if (edge.type != v8::HeapGraphEdge::kElement &&
+            edge.type != v8::HeapGraphEdge::kHidden) {
+          CHECK_LT(edge.name_or_index, result.strings.size());
+        }
+        result.edges.push_back(edge);
+        break;
+      }
+      case 3: {
+        DecodedBinarySnapshot::Node node;
+        node.type = static_cast<uint32_t>(read_varint());
+        node.name = static_cast<uint32_t>(read_varint());
+        CHECK_LT(node.name, result.strings.size());
+        node.id = static_cast<uint32_t>(read_varint());
+        node.self_size = read_varint();
+        read_varint();  // trace_node_id
+        read_varint();  // detachedness
+        result.nodes.push_back(node);
+        break;
+      }
+      case 4:
+        for (int i = 0; i < 4; i++) read_varint();
+        result.location_count++;
+        break;
+      default:
+        UNREACHABLE();
+    }
+  }
+  CHECK_EQ(pos, data.size());
+  for (const DecodedBinarySnapshot::Edge& edge : result.edges) {
+    CHECK_LT(edge.from, result.nodes.size());
+    CHECK_LT(edge.to, result.nodes.size());
+  }
+  return result;
+}
+
+bool HasNodeNamed(const DecodedBinarySnapshot& snapshot, const char* name) {
+  for (const DecodedBinarySnapshot::Node& node : snapshot.nodes) {
+    if (snapshot.strings[node.name] == name) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env.isolate());
+  v8::HeapProfiler* heap_profiler = env.isolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = new A('String \\u0101\\u8001');");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  v8::internal::TestJSONStream stream;
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(1, stream.eos_signaled());
+  DecodedBinarySnapshot decoded = DecodeBinarySnapshot(&stream);
+  CHECK_EQ(snapshot->GetNodesCount(), static_cast<int>(decoded.nodes.size()));
+  const i::HeapSnapshot* i_snapshot =
+      reinterpret_cast<const i::HeapSnapshot*>(snapshot);
+  CHECK_EQ(i_snapshot->edges().size(), decoded.edges.size());
+  CHECK_EQ(i_snapshot->locations().size(), decoded.location_count);
+  for (int i = 0; i < snapshot->GetNodesCount(); i++) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    CHECK_EQ(node->GetId(), decoded.nodes[i].id);
+    CHECK_EQ(node->GetShallowSize(), decoded.nodes[i].self_size);
+  }
+  CHECK(HasNodeNamed(decoded, "A"));
+  CHECK(HasNodeNamed(decoded, "String \xC4\x81\xE8\x80\x81"));
+}
+
+TEST(HeapSnapshotStreaming) {
+  LocalContext env;
+  v8::HandleScope scope(env.isolate());
+  v8::HeapProfiler* heap_profiler = env.isolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = [];\n"
+      "for (var i = 0; i < 1000; i++) a.push(new A('s' + i));");
+  int snapshot_count = heap_profiler->GetSnapshotCount();
+
+  v8::internal::TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_EQ(1, stream.eos_signaled());
+  // Streamed snapshots are not retained.
+  CHECK_EQ(snapshot_count, heap_profiler->GetSnapshotCount());
+  DecodedBinarySnapshot decoded = DecodeBinarySnapshot(&stream);
+  CHECK(HasNodeNamed(decoded, "A"));
+  CHECK(HasNodeNamed(decoded, "s999"));
+  CHECK_GT(decoded.edges.size(), decoded.nodes.size());
+  // The synthetic root comes first and references the GC roots.
+  CHECK_EQ(v8::HeapGraphNode::kSynthetic, decoded.nodes[0].type);
+  bool root_has_edges = false;
+  for (const DecodedBinarySnapshot::Edge& edge : decoded.edges) {
+    if (edge.from == 0) root_has_edges = true;
+  }
+  CHECK(root_has_edges);
+
+  v8::internal::TestJSONStream aborting_stream(5);
+  CHECK(!heap_profiler->TakeHeapSnapshotToStream(&aborting_stream));
+  CHECK_EQ(0, aborting_stream.eos_signaled());
+}
+
+TEST(HeapSnapshotStreamingReleasesNames) {
+  LocalContext env;
+  v8::HandleScope scope(env.isolate());
+  v8::HeapProfiler* heap_profiler = env.isolate()->GetHeapProfiler();
+  i::HeapProfiler* i_heap_profiler =
+      reinterpret_cast<i::HeapProfiler*>(heap_profiler);
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = [];\n"
+      "for (var i = 0; i < 1000; i++) a.push(new A('s' + i));");
+
+  v8::internal::TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  const size_t string_count =
+      i_heap_profiler->names()->GetStringCountForTesting();
+  CompileRun("for (var i = 0; i < 1000; i++) a.push(new A('t' + i));");
+  v8::internal::TestJSONStream second_stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&second_stream));
+  CHECK(HasNodeNamed(DecodeBinarySnapshot(&second_stream), "t999"));
+  CHECK_EQ(string_count, i_heap_profiler->names()->GetStringCountForTesting());
+
+  v8::internal::TestJSONStream aborting_stream(5);
+  CHECK(!heap_profiler->TakeHeapSnapshotToStream(&aborting_stream));
+  CHECK_EQ(string_count, i_heap_profiler->names()->GetStringCountForTesting());
+}
+
+namespace {
+
 class TestStatsStream : public v8::OutputStream {
  public:
   TestStatsStream()
@@ -4330,6 +4520,64 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerSurvivalAndDeltas) {
+  i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      CcTest::heap());
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env.isolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  i::v8_flags.sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(256);
+  CompileRun(
+      "var retained = [];\n"
+      "for (var i = 0; i < 1000; ++i) retained.push({i});\n");
+
+  // The first delta reports every sample.
+  std::unique_ptr<v8::AllocationProfile> first(
+      heap_profiler->GetAllocationProfileDelta());
+  CHECK(first);
+  CHECK(!first->GetSamples().empty());
+  std::unordered_set<uint64_t> reported;
+  for (auto& sample : first->GetSamples()) {
+    CHECK(sample.is_live);
+    reported.insert(sample.sample_id);
+  }
+
+  i::heap::InvokeMajorGC(CcTest::heap());
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  for (auto& sample : profile->GetSamples()) {
+    if (reported.count(sample.sample_id)) CHECK_GE(sample.survived_gcs, 1u);
+  }
+
+  // Live samples are reported once, and again when their objects die.
+  std::unique_ptr<v8::AllocationProfile> second(
+      heap_profiler->GetAllocationProfileDelta());
+  for (auto& sample : second->GetSamples()) {
+    CHECK_EQ(sample.is_live ? 0 : 1, reported.count(sample.sample_id));
+  }
+  for (auto& sample : second->GetSamples()) {
+    if (sample.is_live) reported.insert(sample.sample_id);
+  }
+
+  CompileRun("retained = null;");
+  i::heap::InvokeMajorGC(CcTest::heap());
+  std::unique_ptr<v8::AllocationProfile> third(
+      heap_profiler->GetAllocationProfileDelta());
+  size_t collected = 0;
+  for (auto& sample : third->GetSamples()) {
+    if (sample.is_live) continue;
+    CHECK_EQ(1, reported.count(sample.sample_id));
+    collected++;
+  }
+  CHECK_GT(collected, 0);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
@@ -3121,6 +3121,100 @@ TEST(CodeSerializerEmptyContextDependency) {
   v8_flags.empty_context_extension_dep = prev_empty_context_extension_dep;
 }
 
+namespace {
+
+Tagged<SharedFunctionInfo> GetGlobalFunctionShared(
+    v8::Local<v8::Context> context, const char* name) {
+  v8::Local<v8::Function> function = v8::Local<v8::Function>::Cast(
+      context->Global()->Get(context, v8_str(name)).ToLocalChecked());
+  return Cast<JSFunction>(*v8::Utils::OpenDirectHandle(*function))->shared();
+}
+
+}  // namespace
+
+TEST(CodeSerializerTieringDecisions) {
+  if (!v8_flags.profile_guided_optimization || !v8_flags.maglev ||
+      !v8_flags.turbofan) {
+    return;
+  }
+  bool prev_allow_natives_syntax = v8_flags.allow_natives_syntax;
+  bool prev_code_cache_tiering_decisions =
+      v8_flags.code_cache_tiering_decisions;
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.code_cache_tiering_decisions = true;
+
+  const char* js_source =
+      "function f(o) { return o.a; };"
+      "function g() { return 'abc'; }; g() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(js_source),
+                                      v8::ScriptOrigin(v8_str("test")));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate1, &source, v8::ScriptCompiler::kNoCompileOptions)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    // Deoptimize `f` right after it reached Maglev, and tier `g` up through
+    // Maglev to Turbofan.
+    CompileRun(context,
+               "%PrepareFunctionForOptimization(f);"
+               "f({a: 1});"
+               "%OptimizeMaglevOnNextCall(f);"
+               "f({a: 2});"
+               "f({b: 1, a: 3});"
+               "%PrepareFunctionForOptimization(g);"
+               "g();"
+               "%OptimizeMaglevOnNextCall(g);"
+               "g();"
+               "%OptimizeFunctionOnNextCall(g);"
+               "g();")
+        .ToLocalChecked();
+    CHECK_EQ(CachedTieringDecision::kDelayMaglev,
+             GetGlobalFunctionShared(context, "f")->cached_tiering_decision());
+    CHECK_GT(GetGlobalFunctionShared(context, "g")->cached_tiering_decision(),
+             CachedTieringDecision::kDelayMaglev);
+    cache = ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(js_source),
+                                      v8::ScriptOrigin(v8_str("test")), cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    // The delay survives, but the feedback that made early tier-up pay off
+    // does not, so `g` only keeps its early Sparkplug compilation.
+    CHECK_EQ(CachedTieringDecision::kDelayMaglev,
+             GetGlobalFunctionShared(context, "f")->cached_tiering_decision());
+    CHECK_EQ(CachedTieringDecision::kEarlySparkplug,
+             GetGlobalFunctionShared(context, "g")->cached_tiering_decision());
+  }
+  isolate2->Dispose();
+
+  v8_flags.allow_natives_syntax = prev_allow_natives_syntax;
+  v8_flags.code_cache_tiering_decisions = prev_code_cache_tiering_decisions;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
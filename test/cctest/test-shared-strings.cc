@@ -564,6 +564,114 @@ UNINITIALIZED_TEST(ConcurrentStringTableLookup) {
   ParkingThread::ParkedJoinAll(local_isolate, threads);
 }
 
+class ConcurrentKeyInternalizationThread final : public ParkingThread {
+ public:
+  ConcurrentKeyInternalizationThread(MultiClientIsolateTest* test,
+                                     IndirectHandle<FixedArray> results,
+                                     int index, int strings,
+                                     ParkingSemaphore* sema_ready,
+                                     ParkingSemaphore* sema_execute_start,
+                                     ParkingSemaphore* sema_execute_complete)
+      : ParkingThread(base::Thread::Options("ConcurrentKeyInternalization")),
+        test_(test),
+        results_(results),
+        index_(index),
+        strings_(strings),
+        sema_ready_(sema_ready),
+        sema_execute_start_(sema_execute_start),
+        sema_execute_complete_(sema_execute_complete) {}
+
+  void Run() override {
+    IsolateWrapper isolate_wrapper(test_->NewClientIsolate());
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate_wrapper.isolate);
+    Factory* factory = i_isolate->factory();
+
+    sema_ready_->Signal();
+    sema_execute_start_->ParkedWait(i_isolate->main_thread_local_isolate());
+
+    {
+      v8::Isolate::Scope isolate_scope(isolate_wrapper.isolate);
+      HandleScope scope(i_isolate);
+      DirectHandle<FixedArray> results =
+          factory->NewFixedArray(strings_, AllocationType::kSharedOld);
+      for (int i = 0; i < strings_; i++) {
+        std::string key = "concurrent-key-" + std::to_string(i);
+        DirectHandle<String> interned = factory->InternalizeString(
+            base::OneByteVector(key.c_str(), key.length()));
+        CHECK(interned->IsShared());
+        CHECK(IsInternalizedString(*interned));
+        results->set(i, *interned);
+      }
+      results_->set(index_, *results);
+    }
+
+    sema_execute_complete_->Signal();
+  }
+
+ private:
+  MultiClientIsolateTest* test_;
+  IndirectHandle<FixedArray> results_;
+  int index_;
+  int strings_;
+  ParkingSemaphore* sema_ready_;
+  ParkingSemaphore* sema_execute_start_;
+  ParkingSemaphore* sema_execute_complete_;
+};
+
+UNINITIALIZED_TEST(ConcurrentKeyInternalizationWithoutLock) {
+  v8_flags.shared_string_table = true;
+  v8_flags.concurrent_string_table_insertion = true;
+  i::FlagList::EnforceFlagImplications();
+
+  constexpr int kThreads = 4;
+  // Enough strings to resize the string table while inserting.
+  constexpr int kStrings = 8192;
+
+  MultiClientIsolateTest test;
+  Isolate* i_isolate = test.i_main_isolate();
+  Factory* factory = i_isolate->factory();
+
+  HandleScope scope(i_isolate);
+
+  IndirectHandle<FixedArray> results =
+      factory->NewFixedArray(kThreads, AllocationType::kSharedOld);
+
+  ParkingSemaphore sema_ready(0);
+  ParkingSemaphore sema_execute_start(0);
+  ParkingSemaphore sema_execute_complete(0);
+  std::vector<std::unique_ptr<ConcurrentKeyInternalizationThread>> threads;
+  for (int i = 0; i < kThreads; i++) {
+    auto thread = std::make_unique<ConcurrentKeyInternalizationThread>(
+        &test, results, i, kStrings, &sema_ready, &sema_execute_start,
+        &sema_execute_complete);
+    CHECK(thread->Start());
+    threads.push_back(std::move(thread));
+  }
+
+  LocalIsolate* local_isolate = i_isolate->main_thread_local_isolate();
+  for (int i = 0; i < kThreads; i++) {
+    sema_ready.ParkedWait(local_isolate);
+  }
+  for (int i = 0; i < kThreads; i++) {
+    sema_execute_start.Signal();
+  }
+  for (int i = 0; i < kThreads; i++) {
+    sema_execute_complete.ParkedWait(local_isolate);
+  }
+
+  ParkingThread::ParkedJoinAll(local_isolate, threads);
+
+  // All threads must have ended up with the same internalized strings, no
+  // matter which of them won the race to insert a string.
+  Tagged<FixedArray> first = Cast<FixedArray>(results->get(0));
+  for (int t = 1; t < kThreads; t++) {
+    Tagged<FixedArray> other = Cast<FixedArray>(results->get(t));
+    for (int i = 0; i < kStrings; i++) {
+      CHECK_EQ(first->get(i), other->get(i));
+    }
+  }
+}
+
 namespace {
 
 void CheckSharedStringIsEqualCopy(DirectHandle<String> shared,
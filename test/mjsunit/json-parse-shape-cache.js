@@ -0,0 +1,72 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --json-parse-shape-cache
+
+(function TestSameLayout() {
+  const a = JSON.parse('{"shapeA":1,"b":"x","c":[1,2]}');
+  const b = JSON.parse('{"shapeA":2,"b":"y","c":[]}');
+  assertTrue(%HaveSameMap(a, b));
+  assertEquals({shapeA: 2, b: 'y', c: []}, b);
+})();
+
+(function TestMismatchingKeys() {
+  const a = JSON.parse('{"shapeB":1,"b":2,"c":3}');
+  const b = JSON.parse('{"shapeB":1,"x":2,"c":3}');
+  const c = JSON.parse('{"shapeB":1,"b":2}');
+  const d = JSON.parse('{"shapeB":1,"b":2,"c":3,"d":4}');
+  const e = JSON.parse('{"shapeB":1,"b":2,"0":5,"c":3}');
+  assertEquals({shapeB: 1, x: 2, c: 3}, b);
+  assertEquals({shapeB: 1, b: 2}, c);
+  assertEquals({shapeB: 1, b: 2, c: 3, d: 4}, d);
+  assertEquals({shapeB: 1, b: 2, 0: 5, c: 3}, e);
+  assertEquals(['0', 'shapeB', 'b', 'c'], Object.keys(e));
+  assertFalse(%HaveSameMap(a, b));
+  assertFalse(%HaveSameMap(a, d));
+})();
+
+(function TestFieldRepresentations() {
+  const a = JSON.parse('{"shapeC":1,"b":2}');
+  const b = JSON.parse('{"shapeC":1.5,"b":"two"}');
+  const c = JSON.parse('{"shapeC":{},"b":null}');
+  assertEquals({shapeC: 1, b: 2}, a);
+  assertEquals({shapeC: 1.5, b: 'two'}, b);
+  assertEquals({shapeC: {}, b: null}, c);
+  assertTrue(%HaveSameMap(b, JSON.parse('{"shapeC":2.5,"b":"three"}')));
+})();
+
+(function TestKeysThatBypassTheCache() {
+  for (const key of ['', '0', '12', 'a\\"b', 'x'.repeat(100)]) {
+    const json = `{"${key}":1,"b":2}`;
+    const a = JSON.parse(json);
+    const b = JSON.parse(json);
+    assertEquals(a, b);
+    assertEquals(Object.keys(a), Object.keys(b));
+  }
+})();
+
+(function TestCollidingKeys() {
+  // Same length, first and last character: these share a cache entry.
+  const a = JSON.parse('{"axxz":1,"p":2}');
+  const b = JSON.parse('{"ayyz":1,"q":2}');
+  const c = JSON.parse('{"axxz":3,"p":4}');
+  assertEquals({ayyz: 1, q: 2}, b);
+  assertEquals({axxz: 3, p: 4}, c);
+  assertTrue(%HaveSameMap(a, c));
+})();
+
+(function TestTwoByteSource() {
+  const a = JSON.parse('{"shapeD":"\u20ac","b":1}');
+  const b = JSON.parse('{"shapeD":"e","b":2}');
+  assertTrue(%HaveSameMap(a, b));
+  assertEquals({shapeD: '\u20ac', b: 1}, a);
+})();
+
+(function TestDeprecatedMap() {
+  const a = JSON.parse('{"shapeE":1,"b":2}');
+  a.b = {};  // Generalizes the field and deprecates the cached map.
+  const b = JSON.parse('{"shapeE":1,"b":2}');
+  assertEquals({shapeE: 1, b: 2}, b);
+  assertTrue(%HaveSameMap(a, b));
+})();
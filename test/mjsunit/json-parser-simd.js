@@ -0,0 +1,51 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings and whitespace runs around the block sizes of the vectorized
+// scanners, for both one-byte and two-byte sources.
+
+const kLengths = [0, 1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33, 100];
+
+(function TestStrings() {
+  for (const length of kLengths) {
+    for (const filler of ['a', '\u00e9', '\u20ac']) {
+      const plain = filler.repeat(length);
+      assertEquals(plain, JSON.parse(JSON.stringify(plain)));
+      // Two-byte source with a one-byte value and vice versa.
+      assertEquals([plain, '\u20ac'],
+                   JSON.parse(JSON.stringify([plain, '\u20ac'])));
+      for (const special of ['"', '\\', '\n', '\u0001', '\u20ac']) {
+        for (let i = 0; i <= length; i += Math.max(1, length >> 2)) {
+          const value = plain.slice(0, i) + special + plain.slice(i);
+          assertEquals(value, JSON.parse(JSON.stringify(value)));
+        }
+      }
+    }
+  }
+})();
+
+(function TestWhitespace() {
+  for (const length of kLengths) {
+    for (const ws of [' ', '\t', '\r', '\n', ' \n\t\r']) {
+      const pad = ws.repeat(length);
+      assertEquals({a: [1, 'b']},
+                   JSON.parse(`${pad}{${pad}"a"${pad}:${pad}[${pad}1${pad},` +
+                              `${pad}"b"${pad}]${pad}}${pad}`));
+      assertEquals('\u20ac', JSON.parse(`${pad}"\u20ac"${pad}`));
+      assertThrows(() => JSON.parse(pad), SyntaxError);
+      assertThrows(() => JSON.parse(`${pad}\u20ac`), SyntaxError);
+      assertThrows(() => JSON.parse(`${pad}1${pad}x`), SyntaxError);
+    }
+  }
+})();
+
+(function TestUnterminatedAndControlCharacters() {
+  for (const length of kLengths) {
+    const plain = 'a'.repeat(length);
+    assertThrows(() => JSON.parse('"' + plain), SyntaxError);
+    assertThrows(() => JSON.parse('"' + plain + '\u20ac'), SyntaxError);
+    assertThrows(() => JSON.parse('"' + plain + '\u001f"'), SyntaxError);
+    assertThrows(() => JSON.parse('"\u20ac' + plain + '\u0000"'), SyntaxError);
+  }
+})();
@@ -94,3 +94,47 @@ TEST_F(ContextTest, HasTemplateLiteralObject) {
   ASSERT_FALSE(context2->HasTemplateLiteralObject(otherObject2_ctx2));
   ASSERT_FALSE(context2->HasTemplateLiteralObject(otherObject2_ctx2));
 }
+
+TEST_F(ContextTest, ContextAllocationLimit) {
+  struct Reports {
+    v8::Local<v8::Context> expected_context;
+    int count = 0;
+    size_t allocated_bytes = 0;
+  };
+  constexpr size_t kLimit = 1024 * 1024;
+  const char* allocate_source = R"(
+    const arrays = [];
+    for (let i = 0; i < 1000; i++) arrays.push(new Array(1000).fill(i));
+  )";
+
+  v8::Local<v8::Context> tenant = v8::Context::New(isolate());
+  v8::Local<v8::Context> other = v8::Context::New(isolate());
+  Reports reports{tenant};
+  isolate()->SetContextAllocationLimitCallback(
+      [](v8::Local<v8::Context> context, size_t allocated_bytes, void* data) {
+        Reports* reports = static_cast<Reports*>(data);
+        EXPECT_TRUE(reports->expected_context == context);
+        reports->count++;
+        reports->allocated_bytes = allocated_bytes;
+      },
+      &reports);
+  isolate()->SetContextAllocationLimit(tenant, kLimit);
+  isolate()->SetContextAllocationLimit(other, 0);
+
+  {
+    v8::Context::Scope scope(other);
+    RunJS(allocate_source, other);
+  }
+  EXPECT_EQ(0, reports.count);
+  EXPECT_EQ(0u, isolate()->GetContextAllocatedBytes(tenant));
+  EXPECT_GE(isolate()->GetContextAllocatedBytes(other), kLimit);
+
+  {
+    v8::Context::Scope scope(tenant);
+    RunJS(allocate_source, tenant);
+  }
+  EXPECT_EQ(1, reports.count);
+  EXPECT_GE(reports.allocated_bytes, kLimit);
+  EXPECT_GE(isolate()->GetContextAllocatedBytes(tenant),
+            reports.allocated_bytes);
+}
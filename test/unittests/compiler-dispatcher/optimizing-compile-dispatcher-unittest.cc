@@ -6,9 +6,12 @@
 
 #include <memory>
 
+#include "include/v8-context.h"
+#include "include/v8-script.h"
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
 #include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/execution/isolate.h"
@@ -17,6 +20,7 @@
 #include "src/heap/local-heap.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -107,5 +111,307 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   i_isolate()->SetOptimizingCompileDispatcherForTesting(original);
 }
 
+TEST_F(OptimizingCompileDispatcherTest, Priority) {
+  // Functions invoked more often per second come first.
+  EXPECT_GT(OptimizingCompileInputQueue::Priority(false, 0, 10000, 100),
+            OptimizingCompileInputQueue::Priority(false, 0, 100, 100));
+  // Among equally hot functions, cheaper ones come first.
+  EXPECT_GT(OptimizingCompileInputQueue::Priority(false, 0, 1000, 100),
+            OptimizingCompileInputQueue::Priority(false, 0, 1000, 10000));
+  // Hotness outweighs compile cost.
+  EXPECT_GT(OptimizingCompileInputQueue::Priority(false, 0, 10000, 10000),
+            OptimizingCompileInputQueue::Priority(false, 0, 100, 100));
+  // OSR requests come before regular ones, and urgent ones first.
+  EXPECT_GT(OptimizingCompileInputQueue::Priority(true, 0, 1, 100000),
+            OptimizingCompileInputQueue::Priority(false, 0, 100000, 1));
+  EXPECT_GT(OptimizingCompileInputQueue::Priority(true, 3, 1, 100),
+            OptimizingCompileInputQueue::Priority(true, 1, 1, 100));
+  EXPECT_LT(OptimizingCompileInputQueue::Priority(true, 6, kMaxInt, 0),
+            OptimizingCompileInputQueue::kMaxPriority);
+}
+
+namespace {
+
+Handle<JSFunction> CompiledFunction(Isolate* isolate,
+                                   Handle<JSFunction> function) {
+  IsCompiledScope is_compiled_scope;
+  CHECK(Compiler::Compile(isolate, function, Compiler::CLEAR_EXCEPTION,
+                          &is_compiled_scope));
+  return function;
+}
+
+TurbofanCompilationJob* Enqueue(OptimizingCompileInputQueue& queue,
+                                Isolate* isolate, Handle<JSFunction> function,
+                                int priority) {
+  std::unique_ptr<TurbofanCompilationJob> job =
+      std::make_unique<BlockingCompilationJob>(isolate, function);
+  TurbofanCompilationJob* raw_job = job.get();
+  CHECK(queue.Enqueue(job, priority));
+  return raw_job;
+}
+
+std::unique_ptr<TurbofanCompilationJob> Dequeue(
+    OptimizingCompileInputQueue& queue) {
+  OptimizingCompileTaskState task_state{};
+  return std::unique_ptr<TurbofanCompilationJob>(queue.Dequeue(task_state));
+}
+
+}  // namespace
+
+TEST_F(OptimizingCompileDispatcherTest, DequeueByPriority) {
+  FlagScope<bool> priority_queue(
+      &v8_flags.concurrent_recompilation_priority_queue, true);
+  FlagScope<int> aging(&v8_flags.concurrent_recompilation_aging_ms, 0);
+  Handle<JSFunction> fun = CompiledFunction(
+      i_isolate(), RunJS<JSFunction>("function f() {}; f;"));
+  OptimizingCompileInputQueue queue(8);
+
+  TurbofanCompilationJob* low = Enqueue(queue, i_isolate(), fun, 1);
+  TurbofanCompilationJob* high = Enqueue(queue, i_isolate(), fun, 3);
+  TurbofanCompilationJob* medium = Enqueue(queue, i_isolate(), fun, 2);
+  TurbofanCompilationJob* other_medium = Enqueue(queue, i_isolate(), fun, 2);
+
+  EXPECT_EQ(high, Dequeue(queue).get());
+  // Jobs of equal priority are dequeued in FIFO order.
+  EXPECT_EQ(medium, Dequeue(queue).get());
+  EXPECT_EQ(other_medium, Dequeue(queue).get());
+  EXPECT_EQ(low, Dequeue(queue).get());
+  EXPECT_EQ(0u, queue.Length());
+}
+
+TEST_F(OptimizingCompileDispatcherTest, DequeueInFifoOrder) {
+  FlagScope<bool> priority_queue(
+      &v8_flags.concurrent_recompilation_priority_queue, false);
+  Handle<JSFunction> fun = CompiledFunction(
+      i_isolate(), RunJS<JSFunction>("function f() {}; f;"));
+  OptimizingCompileInputQueue queue(8);
+
+  TurbofanCompilationJob* low = Enqueue(queue, i_isolate(), fun, 1);
+  TurbofanCompilationJob* high = Enqueue(queue, i_isolate(), fun, 3);
+
+  EXPECT_EQ(low, Dequeue(queue).get());
+  EXPECT_EQ(high, Dequeue(queue).get());
+}
+
+class OptimizingCompileInputQueueTest : public TestWithNativeContext {
+ protected:
+  static int RunningTasks(OptimizingCompileInputQueue& queue,
+                          Isolate* isolate) {
+    base::MutexGuard access(&queue.mutex_);
+    auto it = queue.running_tasks_.find(isolate);
+    return it == queue.running_tasks_.end() ? 0 : it->second;
+  }
+
+  static int RunningTasks(OptimizingCompileTaskExecutor& task_executor,
+                          Isolate* isolate) {
+    return RunningTasks(task_executor.input_queue_, isolate);
+  }
+
+  // Makes the queue read the time from `now_`, which tests advance by hand.
+  static void UseFakeClock(OptimizingCompileInputQueue& queue) {
+    now_ = base::TimeTicks::Now();
+    queue.now_ = []() { return now_; };
+  }
+
+  static base::TimeTicks now_;
+
+  // Stops the task like OptimizingCompileTaskExecutor::ClearTaskState().
+  static void StopTask(OptimizingCompileInputQueue& queue,
+                       OptimizingCompileTaskState& task_state) {
+    base::MutexGuard access(&queue.mutex_);
+    queue.TaskStopped(task_state.isolate);
+    task_state.isolate = nullptr;
+    task_state.job = nullptr;
+  }
+};
+
+base::TimeTicks OptimizingCompileInputQueueTest::now_;
+
+TEST_F(OptimizingCompileInputQueueTest, AgingOvertakesPriority) {
+  FlagScope<bool> priority_queue(
+      &v8_flags.concurrent_recompilation_priority_queue, true);
+  FlagScope<int> aging(&v8_flags.concurrent_recompilation_aging_ms, 1);
+  Handle<JSFunction> fun = CompiledFunction(
+      i_isolate(), RunJS<JSFunction>("function f() {}; f;"));
+  OptimizingCompileInputQueue queue(8);
+  UseFakeClock(queue);
+
+  TurbofanCompilationJob* old_job = Enqueue(queue, i_isolate(), fun, 0);
+  // The old job gains one priority point per millisecond it waits, so after
+  // 50ms it is ahead of the newer jobs.
+  now_ += base::TimeDelta::FromMilliseconds(50);
+  TurbofanCompilationJob* new_job = Enqueue(queue, i_isolate(), fun, 20);
+  TurbofanCompilationJob* newer_job = Enqueue(queue, i_isolate(), fun, 10);
+
+  EXPECT_EQ(old_job, Dequeue(queue).get());
+  EXPECT_EQ(new_job, Dequeue(queue).get());
+  EXPECT_EQ(newer_job, Dequeue(queue).get());
+}
+
+TEST_F(OptimizingCompileInputQueueTest, FairScheduling) {
+  FlagScope<bool> fair_scheduling(
+      &v8_flags.concurrent_recompilation_fair_scheduling, true);
+  Handle<JSFunction> fun = CompiledFunction(
+      i_isolate(), RunJS<JSFunction>("function f() {}; f;"));
+  OptimizingCompileInputQueue queue(8);
+  TurbofanCompilationJob* job1 = Enqueue(queue, i_isolate(), fun, 0);
+  TurbofanCompilationJob* job2 = Enqueue(queue, i_isolate(), fun, 0);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = isolate()->array_buffer_allocator();
+  v8::Isolate* other = v8::Isolate::New(create_params);
+  Isolate* i_other = reinterpret_cast<Isolate*>(other);
+  {
+    v8::Isolate::Scope isolate_scope(other);
+    v8::HandleScope handle_scope(other);
+    v8::Local<v8::Context> context = v8::Context::New(other);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::Value> other_f =
+        v8::Script::Compile(context, v8::String::NewFromUtf8Literal(
+                                         other, "function f() {}; f;"))
+            .ToLocalChecked()
+            ->Run(context)
+            .ToLocalChecked();
+    Handle<JSFunction> other_fun = CompiledFunction(
+        i_other,
+        handle(Cast<JSFunction>(*Utils::OpenDirectHandle(*other_f)), i_other));
+    TurbofanCompilationJob* other_job = Enqueue(queue, i_other, other_fun, 0);
+
+    // Without running tasks, jobs are dequeued in FIFO order.
+    OptimizingCompileTaskState task1{};
+    std::unique_ptr<TurbofanCompilationJob> first(queue.Dequeue(task1));
+    EXPECT_EQ(job1, first.get());
+    EXPECT_EQ(1, RunningTasks(queue, i_isolate()));
+
+    // The other isolate has no running task, so its job overtakes job2.
+    OptimizingCompileTaskState task2{};
+    std::unique_ptr<TurbofanCompilationJob> second(queue.Dequeue(task2));
+    EXPECT_EQ(other_job, second.get());
+    EXPECT_EQ(1, RunningTasks(queue, i_other));
+
+    // A task that continues with the next job of its isolate does not count
+    // against that isolate.
+    task1.job = nullptr;
+    std::unique_ptr<TurbofanCompilationJob> third(
+        queue.DequeueIfIsolateMatches(task1));
+    EXPECT_EQ(job2, third.get());
+    EXPECT_EQ(1, RunningTasks(queue, i_isolate()));
+
+    StopTask(queue, task1);
+    EXPECT_EQ(0, RunningTasks(queue, i_isolate()));
+    EXPECT_EQ(1, RunningTasks(queue, i_other));
+    StopTask(queue, task2);
+    EXPECT_EQ(0, RunningTasks(queue, i_other));
+  }
+  other->Dispose();
+}
+
+TEST_F(OptimizingCompileInputQueueTest, FairAdmission) {
+  FlagScope<bool> fair_scheduling(
+      &v8_flags.concurrent_recompilation_fair_scheduling, true);
+  Handle<JSFunction> fun = CompiledFunction(
+      i_isolate(), RunJS<JSFunction>("function f() {}; f;"));
+  OptimizingCompileInputQueue queue(8);
+  auto try_enqueue = [&queue](Isolate* isolate, Handle<JSFunction> function) {
+    std::unique_ptr<TurbofanCompilationJob> job =
+        std::make_unique<BlockingCompilationJob>(isolate, function);
+    return queue.Enqueue(job);
+  };
+
+  // An isolate on its own leaves half of the queue to the next isolate.
+  for (int i = 0; i < 4; i++) EXPECT_TRUE(try_enqueue(i_isolate(), fun));
+  EXPECT_FALSE(queue.IsAvailable(i_isolate()));
+  EXPECT_FALSE(try_enqueue(i_isolate(), fun));
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = isolate()->array_buffer_allocator();
+  v8::Isolate* other = v8::Isolate::New(create_params);
+  Isolate* i_other = reinterpret_cast<Isolate*>(other);
+  {
+    v8::Isolate::Scope isolate_scope(other);
+    v8::HandleScope handle_scope(other);
+    v8::Local<v8::Context> context = v8::Context::New(other);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::Value> other_f =
+        v8::Script::Compile(context, v8::String::NewFromUtf8Literal(
+                                         other, "function f() {}; f;"))
+            .ToLocalChecked()
+            ->Run(context)
+            .ToLocalChecked();
+    Handle<JSFunction> other_fun = CompiledFunction(
+        i_other,
+        handle(Cast<JSFunction>(*Utils::OpenDirectHandle(*other_f)), i_other));
+
+    // The other isolate still finds room, up to its share of the queue.
+    EXPECT_TRUE(queue.IsAvailable(i_other));
+    EXPECT_TRUE(try_enqueue(i_other, other_fun));
+    EXPECT_TRUE(try_enqueue(i_other, other_fun));
+    EXPECT_FALSE(try_enqueue(i_other, other_fun));
+    EXPECT_EQ(6u, queue.Length());
+
+    // Jobs hold handles of their isolate, so drop them before disposing it.
+    while (queue.Length() > 0) {
+      OptimizingCompileTaskState task_state{};
+      std::unique_ptr<TurbofanCompilationJob> job(queue.Dequeue(task_state));
+      StopTask(queue, task_state);
+    }
+  }
+  other->Dispose();
+}
+
+TEST_F(OptimizingCompileInputQueueTest, AdmissionWithoutFairScheduling) {
+  FlagScope<bool> fair_scheduling(
+      &v8_flags.concurrent_recompilation_fair_scheduling, false);
+  Handle<JSFunction> fun = CompiledFunction(
+      i_isolate(), RunJS<JSFunction>("function f() {}; f;"));
+  OptimizingCompileInputQueue queue(8);
+  // A single isolate may fill the whole queue.
+  for (int i = 0; i < 8; i++) Enqueue(queue, i_isolate(), fun, 0);
+  EXPECT_FALSE(queue.IsAvailable(i_isolate()));
+  while (queue.Length() > 0) Dequeue(queue);
+}
+
+TEST_F(OptimizingCompileInputQueueTest, FlushStopsRunningTasks) {
+  FlagScope<bool> fair_scheduling(
+      &v8_flags.concurrent_recompilation_fair_scheduling, true);
+  FlagScope<unsigned int> max_threads(
+      &v8_flags.concurrent_turbofan_max_threads, 1);
+  Handle<JSFunction> fun = CompiledFunction(
+      i_isolate(), RunJS<JSFunction>("function f() {}; f;"));
+  OptimizingCompileTaskExecutor task_executor;
+  task_executor.EnsureStarted();
+  OptimizingCompileDispatcher dispatcher(i_isolate(), &task_executor);
+  OptimizingCompileDispatcher* const original =
+      i_isolate()->SetOptimizingCompileDispatcherForTesting(&dispatcher);
+
+  BlockingCompilationJob* running =
+      new BlockingCompilationJob(i_isolate(), fun);
+  std::unique_ptr<TurbofanCompilationJob> running_job(running);
+  ASSERT_TRUE(dispatcher.TryQueueForOptimization(running_job));
+
+  // Busy-wait for the job to run on the only compile thread.
+  while (!running->IsBlocking()) {
+  }
+  EXPECT_EQ(1, RunningTasks(task_executor, i_isolate()));
+
+  // This job stays queued while the compile thread is blocked.
+  std::unique_ptr<TurbofanCompilationJob> queued_job =
+      std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+  ASSERT_TRUE(dispatcher.TryQueueForOptimization(queued_job));
+
+  // Flushing drops the queued job, which never counted as running, and
+  // cancels the running job, whose task stops once the job returns.
+  dispatcher.Flush(BlockingBehavior::kDontBlock);
+  EXPECT_EQ(1, RunningTasks(task_executor, i_isolate()));
+  running->Signal();
+  dispatcher.WaitUntilCompilationJobsDone();
+  EXPECT_EQ(0, RunningTasks(task_executor, i_isolate()));
+
+  dispatcher.StartTearDown();
+  dispatcher.FinishTearDown();
+  task_executor.Stop();
+  i_isolate()->SetOptimizingCompileDispatcherForTesting(original);
+}
+
 }  // namespace internal
 }  // namespace v8
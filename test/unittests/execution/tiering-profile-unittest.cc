@@ -0,0 +1,174 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <string>
+
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-script.h"
+#include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/utils/utils.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(TieringProfile, DecisionForUnoptimizedFunction) {
+  TieringProfile::Record record;
+  EXPECT_EQ(CachedTieringDecision::kPending,
+            TieringProfile::DecisionFor(record));
+}
+
+TEST(TieringProfile, DecisionSkipsTiersBelowTurbofan) {
+  TieringProfile::Record record;
+  record.maglev = {2, 2, 1.0};
+  record.turbofan = {1, 0, 100.0};
+  EXPECT_EQ(CachedTieringDecision::kEarlyTurbofan,
+            TieringProfile::DecisionFor(record));
+}
+
+TEST(TieringProfile, DecisionForMaglevOnly) {
+  TieringProfile::Record record;
+  record.maglev = {2, 1, 50.0};
+  record.turbofan = {1, 1, 5.0};
+  EXPECT_EQ(CachedTieringDecision::kEarlyMaglev,
+            TieringProfile::DecisionFor(record));
+}
+
+TEST(TieringProfile, DecisionDelaysWhenNoTierPaidOff) {
+  TieringProfile::Record record;
+  record.maglev = {3, 3, 1.0};
+  EXPECT_EQ(CachedTieringDecision::kDelayMaglev,
+            TieringProfile::DecisionFor(record));
+}
+
+TEST(TieringProfile, SerializeAndParse) {
+  absl::flat_hash_map<TieringProfile::FunctionKey, TieringProfile::Record>
+      records;
+  TieringProfile::Record& record =
+      records[TieringProfile::FunctionKey("file:///a b.js", 10, 42)];
+  record.maglev = {1, 1, 2.5};
+  record.turbofan = {1, 0, 30.0};
+
+  auto parsed = TieringProfile::Parse(TieringProfile::Serialize(records));
+  ASSERT_EQ(1u, parsed.size());
+  const TieringProfile::Record& result =
+      parsed[TieringProfile::FunctionKey("file:///a b.js", 10, 42)];
+  EXPECT_EQ(1u, result.maglev.compiles);
+  EXPECT_EQ(1u, result.maglev.deopts);
+  EXPECT_DOUBLE_EQ(2.5, result.maglev.time_in_tier_ms);
+  EXPECT_EQ(1u, result.turbofan.compiles);
+  EXPECT_EQ(0u, result.turbofan.deopts);
+  EXPECT_DOUBLE_EQ(30.0, result.turbofan.time_in_tier_ms);
+}
+
+TEST(TieringProfile, ParseMergesAndSkipsMalformedLines) {
+  auto parsed = TieringProfile::Parse(
+      "10 42 1 0 1.000 0 0 0.000 a.js\n"
+      "garbage\n"
+      "10 42 0 0 0.000 1 1 2.000\n"
+      "10 42 1 1 1.000 1 0 3.000 a.js\n");
+  ASSERT_EQ(1u, parsed.size());
+  const TieringProfile::Record& result =
+      parsed[TieringProfile::FunctionKey("a.js", 10, 42)];
+  EXPECT_EQ(2u, result.maglev.compiles);
+  EXPECT_EQ(1u, result.maglev.deopts);
+  EXPECT_EQ(1u, result.turbofan.compiles);
+  EXPECT_EQ(0u, result.turbofan.deopts);
+}
+
+namespace {
+
+class TieringProfileTest : public TestWithIsolate {
+ protected:
+  // Runs `source` as a script named "tiering-profile-test.js" in a new isolate
+  // and returns the tiering decision of its function `f` afterwards.
+  CachedTieringDecision RunInNewIsolate(const char* source) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = isolate()->array_buffer_allocator();
+    v8::Isolate* new_isolate = v8::Isolate::New(create_params);
+    CachedTieringDecision decision;
+    {
+      v8::Isolate::Scope isolate_scope(new_isolate);
+      v8::HandleScope handle_scope(new_isolate);
+      v8::Local<v8::Context> context = v8::Context::New(new_isolate);
+      v8::Context::Scope context_scope(context);
+      v8::ScriptOrigin origin(
+          v8::String::NewFromUtf8Literal(new_isolate,
+                                         "tiering-profile-test.js"));
+      v8::ScriptCompiler::Source script_source(
+          v8::String::NewFromUtf8(new_isolate, source).ToLocalChecked(),
+          origin);
+      v8::ScriptCompiler::Compile(context, &script_source)
+          .ToLocalChecked()
+          ->Run(context)
+          .ToLocalChecked();
+      v8::Local<v8::Value> f =
+          context->Global()
+              ->Get(context, v8::String::NewFromUtf8Literal(new_isolate, "f"))
+              .ToLocalChecked();
+      decision = Cast<JSFunction>(*Utils::OpenDirectHandle(*f))
+                     ->shared()
+                     ->cached_tiering_decision();
+    }
+    // Disposing the isolate writes the recording.
+    new_isolate->Dispose();
+    return decision;
+  }
+};
+
+}  // namespace
+
+TEST_F(TieringProfileTest, RecordAndReplay) {
+  if (!v8_flags.turbofan || !v8_flags.profile_guided_optimization) return;
+  const std::string path =
+      "tiering-profile-" +
+      std::to_string(base::OS::GetCurrentProcessId()) + ".txt";
+  base::OS::Remove(path.c_str());
+  // Both runs define `f` at the same source position.
+  const char* kFunction = "function f(o) { return o.a; }\n";
+
+  {
+    FlagScope<bool> allow_natives_syntax(&v8_flags.allow_natives_syntax,
+                                         true);
+    FlagScope<const char*> record(&v8_flags.tiering_profile_record,
+                                  path.c_str());
+    // Optimize `f` with Turbofan, then deoptimize it with a new map.
+    RunInNewIsolate((std::string(kFunction) +
+                     "%PrepareFunctionForOptimization(f);"
+                     "f({a: 1});"
+                     "f({a: 2});"
+                     "%OptimizeFunctionOnNextCall(f);"
+                     "f({a: 3});"
+                     "f({b: 1, a: 4});")
+                        .c_str());
+  }
+
+  bool exists = false;
+  std::string recording = ReadFile(path.c_str(), &exists, false);
+  ASSERT_TRUE(exists);
+  auto records = TieringProfile::Parse(recording);
+  ASSERT_EQ(1u, records.size());
+  const TieringProfile::Record& record = records.begin()->second;
+  EXPECT_EQ(1u, record.turbofan.compiles);
+  EXPECT_EQ(1u, record.turbofan.deopts);
+
+  {
+    // Turbofan did not pay off, so the replay delays tiering up `f`.
+    FlagScope<const char*> replay(&v8_flags.tiering_profile, path.c_str());
+    EXPECT_EQ(CachedTieringDecision::kDelayMaglev,
+              RunInNewIsolate((std::string(kFunction) + "f({a: 1});").c_str()));
+  }
+  base::OS::Remove(path.c_str());
+}
+
+}  // namespace internal
+}  // namespace v8
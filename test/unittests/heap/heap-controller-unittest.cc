@@ -52,6 +52,51 @@ TEST_F(MemoryControllerTest, HeapGrowingFactor) {
                     V8Controller::DynamicGrowingFactor(400, 1, 4.0));
 }
 
+TEST_F(MemoryControllerTest, ConcurrentMarkingGrowingFactor) {
+  CheckEqualRounded(V8HeapTrait::kMinGrowingFactor,
+                    V8Controller::ConcurrentMarkingGrowingFactor(100, 1));
+  CheckEqualRounded(1.2, V8Controller::ConcurrentMarkingGrowingFactor(100, 10));
+  CheckEqualRounded(1.5, V8Controller::ConcurrentMarkingGrowingFactor(100, 25));
+  CheckEqualRounded(V8HeapTrait::kMaxGrowingFactor,
+                    V8Controller::ConcurrentMarkingGrowingFactor(100, 1000));
+}
+
+TEST_F(MemoryControllerTest, PauseTargetGrowingFactor) {
+  Heap* heap = i_isolate()->heap();
+  const size_t max_old_generation_size = 512 * MB;
+  const size_t live_size = 128 * MB;
+  const double atomic_gc_speed = 1 * MB;
+  const double gc_speed = 100;
+  const double mutator_speed = 10;
+  const double throughput_factor = V8Controller::GrowingFactor(
+      heap, max_old_generation_size, gc_speed, mutator_speed,
+      Heap::HeapGrowingMode::kDefault);
+
+  // A non-incremental collection takes 128ms. Larger pause targets keep the
+  // throughput-oriented factor.
+  CheckEqualRounded(throughput_factor,
+                    V8Controller::PauseTargetGrowingFactor(
+                        heap, max_old_generation_size, 200, live_size,
+                        atomic_gc_speed, gc_speed, mutator_speed,
+                        Heap::HeapGrowingMode::kDefault));
+  // Smaller targets pick the smallest factor that lets marking finish
+  // concurrently.
+  CheckEqualRounded(1.2, V8Controller::PauseTargetGrowingFactor(
+                             heap, max_old_generation_size, 10, live_size,
+                             atomic_gc_speed, gc_speed, mutator_speed,
+                             Heap::HeapGrowingMode::kDefault));
+  CheckEqualRounded(1.2, V8Controller::PauseTargetGrowingFactor(
+                             heap, max_old_generation_size, 10, live_size,
+                             std::nullopt, gc_speed, mutator_speed,
+                             Heap::HeapGrowingMode::kDefault));
+  // Memory pressure takes precedence.
+  CheckEqualRounded(V8HeapTrait::kMinGrowingFactor,
+                    V8Controller::PauseTargetGrowingFactor(
+                        heap, max_old_generation_size, 10, live_size,
+                        atomic_gc_speed, gc_speed, 90,
+                        Heap::HeapGrowingMode::kMinimal));
+}
+
 TEST_F(MemoryControllerTest, MaxHeapGrowingFactor) {
   const uint64_t physical_memory = 0;
   const size_t min_heap_size = i::Heap::DefaulMinHeapSize(physical_memory);
@@ -4,10 +4,13 @@
 
 #include "src/heap/heap.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <set>
 #include <utility>
+#include <vector>
 
 #include "include/v8-isolate.h"
 #include "include/v8-object.h"
@@ -19,12 +22,15 @@
 #include "src/heap/heap-controller.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap-layout.h"
+#include "src/heap/large-page-metadata-inl.h"
 #include "src/heap/marking-state-inl.h"
+#include "src/heap/memory-allocator.h"
 #include "src/heap/minor-mark-sweep.h"
 #include "src/heap/mutable-page-metadata.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/safepoint.h"
 #include "src/heap/spaces-inl.h"
+#include "src/heap/sweeper.h"
 #include "src/heap/trusted-range.h"
 #include "src/objects/fixed-array.h"
 #include "src/objects/free-space-inl.h"
@@ -32,6 +38,7 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-collection-inl.h"
 #include "src/sandbox/external-pointer-table.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -702,6 +709,216 @@ TEST_F(HeapTest, BlackAllocatedPages) {
   EXPECT_TRUE(in_free_list(page, next));
 }
 
+namespace {
+struct HugePageRegionsTestSetter {
+  HugePageRegionsTestSetter() { v8_flags.huge_page_regions = true; }
+  ~HugePageRegionsTestSetter() { v8_flags.huge_page_regions = false; }
+};
+
+struct HeapTestWithHugePageRegions : HugePageRegionsTestSetter, HeapTest {};
+}  // namespace
+
+TEST_F(HeapTestWithHugePageRegions, PagesArePackedIntoRegions) {
+  static constexpr size_t kRegionSize = size_t{2} * MB;
+  static constexpr size_t kPagesPerRegion = kRegionSize / kRegularPageSize;
+  if (kPagesPerRegion < 2) return;
+
+  MemoryAllocator* allocator = heap()->memory_allocator();
+  const size_t initial_size = allocator->HugePageRegionsSize();
+  const size_t initial_size_in_use = allocator->HugePageRegionsSizeInUse();
+
+  std::vector<PageMetadata*> pages;
+  std::set<Address> regions;
+  for (size_t i = 0; i < kPagesPerRegion; i++) {
+    PageMetadata* page =
+        allocator->AllocatePage(MemoryAllocator::AllocationMode::kRegular,
+                                heap()->old_space(), NOT_EXECUTABLE);
+    ASSERT_NE(nullptr, page);
+    pages.push_back(page);
+    regions.insert(RoundDown(page->ChunkAddress(), kRegionSize));
+  }
+  // The pages fill up at most one partially used region and one new region.
+  EXPECT_LE(regions.size(), 2u);
+  EXPECT_EQ(initial_size_in_use + kPagesPerRegion * kRegularPageSize,
+            allocator->HugePageRegionsSizeInUse());
+  EXPECT_LE(allocator->HugePageRegionsSize(), initial_size + kRegionSize);
+
+  // Pooling is bypassed and regions are only released once empty.
+  for (PageMetadata* page : pages) {
+    allocator->Free(MemoryAllocator::FreeMode::kPool, page);
+  }
+  EXPECT_EQ(initial_size_in_use, allocator->HugePageRegionsSizeInUse());
+  EXPECT_EQ(initial_size, allocator->HugePageRegionsSize());
+}
+
+TEST_F(HeapTestWithHugePageRegions, FreePagesAreDiscarded) {
+  static constexpr size_t kRegionSize = size_t{2} * MB;
+  static constexpr size_t kPagesPerRegion = kRegionSize / kRegularPageSize;
+  if (kPagesPerRegion < 2) return;
+
+  MemoryAllocator* allocator = heap()->memory_allocator();
+  std::vector<PageMetadata*> pages;
+  for (size_t i = 0; i < kPagesPerRegion; i++) {
+    PageMetadata* page =
+        allocator->AllocatePage(MemoryAllocator::AllocationMode::kRegular,
+                                heap()->old_space(), NOT_EXECUTABLE);
+    ASSERT_NE(nullptr, page);
+    pages.push_back(page);
+  }
+  // Free a page whose region stays in use, so its slot stays committed until
+  // memory is reduced. The pages span at most two regions, so one of them
+  // holds at least two pages.
+  auto region_of = [](PageMetadata* page) {
+    return RoundDown(page->ChunkAddress(), kRegionSize);
+  };
+  auto freed_it = std::find_if(pages.begin(), pages.end(), [&](auto* page) {
+    return std::count_if(pages.begin(), pages.end(), [&](auto* other) {
+             return region_of(other) == region_of(page);
+           }) > 1;
+  });
+  ASSERT_NE(pages.end(), freed_it);
+  PageMetadata* freed = *freed_it;
+  pages.erase(freed_it);
+  allocator->Free(MemoryAllocator::FreeMode::kImmediately, freed);
+  allocator->ReleasePooledChunksImmediately();
+  const size_t size_discarded = allocator->HugePageRegionsSizeDiscarded();
+  EXPECT_GE(size_discarded, kRegularPageSize);
+
+  // Discarded slots are reused like any other free slot.
+  PageMetadata* reused =
+      allocator->AllocatePage(MemoryAllocator::AllocationMode::kRegular,
+                              heap()->old_space(), NOT_EXECUTABLE);
+  ASSERT_NE(nullptr, reused);
+  pages.push_back(reused);
+  EXPECT_EQ(size_discarded - kRegularPageSize,
+            allocator->HugePageRegionsSizeDiscarded());
+
+  for (PageMetadata* page : pages) {
+    allocator->Free(MemoryAllocator::FreeMode::kImmediately, page);
+  }
+}
+
+namespace {
+struct AdaptiveNewSpaceSizingTestSetter {
+  AdaptiveNewSpaceSizingTestSetter() {
+    v8_flags.adaptive_new_space_sizing = true;
+  }
+  ~AdaptiveNewSpaceSizingTestSetter() {
+    v8_flags.adaptive_new_space_sizing = false;
+  }
+};
+
+struct HeapTestWithAdaptiveNewSpaceSizing : AdaptiveNewSpaceSizingTestSetter,
+                                            HeapTest {};
+}  // namespace
+
+TEST_F(HeapTestWithAdaptiveNewSpaceSizing, CapacityFollowsSurvivalRatio) {
+  if (v8_flags.single_generation) return;
+  // MinorMS only finishes resizing new space when sweeping is done.
+  if (v8_flags.minor_ms) return;
+  NewSpace* new_space = heap()->new_space();
+  if (!new_space) return;
+  const size_t initial_capacity = new_space->TotalCapacity();
+  if (new_space->MaximumCapacity() < 4 * initial_capacity) return;
+  ManualGCScope manual_gc_scope(isolate());
+  FlagScope<unsigned int> survival_percent(
+      &v8_flags.new_space_target_survival_percent, 5);
+  // Pin the allocation throughput to 4x the initial capacity per collection
+  // interval, so that only the survival ratio of the workload determines the
+  // target.
+  heap()->SetNewSpaceAllocationThroughputForTesting(
+      4.0 * initial_capacity /
+      v8_flags.new_space_target_collection_interval_ms);
+
+  // Runs enough young generation collections to replace all recorded survival
+  // ratios. In every one of them, every |keep_every|-th array survives, or
+  // none if |keep_every| is 0.
+  auto run_workload = [this](int keep_every) {
+    static constexpr int kCollections = 20;
+    static constexpr int kArrays = 256;
+    static constexpr int kArrayLength = 128;
+    for (int gc = 0; gc < kCollections; gc++) {
+      HandleScope scope(isolate());
+      DirectHandle<FixedArray> holder =
+          factory()->NewFixedArray(kArrays, AllocationType::kOld);
+      for (int i = 0; i < kArrays; i++) {
+        HandleScope inner_scope(isolate());
+        DirectHandle<FixedArray> array = factory()->NewFixedArray(kArrayLength);
+        if (keep_every > 0 && i % keep_every == 0) holder->set(i, *array);
+      }
+      InvokeMinorGC();
+    }
+    v8::HeapStatistics stats;
+    v8_isolate()->GetHeapStatistics(&stats);
+    EXPECT_EQ(heap()->NewSpaceTargetCapacity(),
+              stats.young_generation_capacity());
+    return stats;
+  };
+
+  // Almost nothing survives, so new space grows to the target of 4x the
+  // initial capacity.
+  const v8::HeapStatistics low_survival = run_workload(0);
+  EXPECT_GT(low_survival.young_generation_target_capacity(), initial_capacity);
+  EXPECT_GT(low_survival.young_generation_capacity(), initial_capacity);
+
+  // A quarter survives, which is well above the target survival ratio. This
+  // shortens the target collection interval and new space shrinks again.
+  const v8::HeapStatistics high_survival = run_workload(4);
+  EXPECT_LT(low_survival.young_generation_survival_ratio(),
+            high_survival.young_generation_survival_ratio());
+  EXPECT_LT(high_survival.young_generation_target_capacity(),
+            low_survival.young_generation_target_capacity());
+  EXPECT_LT(high_survival.young_generation_capacity(),
+            low_survival.young_generation_capacity());
+}
+
+namespace {
+struct ConcurrentLargePageReleaseTestSetter {
+  ConcurrentLargePageReleaseTestSetter() {
+    v8_flags.concurrent_large_page_release = true;
+  }
+  ~ConcurrentLargePageReleaseTestSetter() {
+    v8_flags.concurrent_large_page_release = false;
+  }
+};
+
+struct HeapTestWithConcurrentLargePageRelease
+    : ConcurrentLargePageReleaseTestSetter,
+      HeapTest {};
+}  // namespace
+
+TEST_F(HeapTestWithConcurrentLargePageRelease,
+       DeadLargePagesAreReleasedBySweeper) {
+  if (!v8_flags.concurrent_sweeping) return;
+  Heap* heap = isolate()->heap();
+  ManualGCScope manual_gc_scope(isolate());
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+  InvokeMajorGC();
+  heap->EnsureSweepingCompleted(Heap::SweepingForcedFinalizationMode::kV8Only);
+  EXPECT_EQ(0u, heap->PendingReleaseBytes());
+
+  size_t page_size;
+  {
+    HandleScope scope(isolate());
+    DirectHandle<FixedArray> array = isolate()->factory()->NewFixedArray(
+        kMaxRegularHeapObjectSize / kTaggedSize, AllocationType::kOld);
+    ASSERT_TRUE(heap->lo_space()->Contains(*array));
+    page_size = LargePageMetadata::FromHeapObject(isolate(), *array)->size();
+  }
+
+  // Without sweeper tasks the dead page stays pending until sweeping is
+  // finalized.
+  heap->delay_sweeper_tasks_for_testing_ = true;
+  InvokeMajorGC();
+  EXPECT_EQ(page_size, heap->sweeper()->PendingLargePageReleaseBytes());
+  v8::HeapStatistics stats;
+  v8_isolate()->GetHeapStatistics(&stats);
+  EXPECT_LE(page_size, stats.pending_release_size());
+  heap->EnsureSweepingCompleted(Heap::SweepingForcedFinalizationMode::kV8Only);
+  EXPECT_EQ(0u, heap->sweeper()->PendingLargePageReleaseBytes());
+  heap->delay_sweeper_tasks_for_testing_ = false;
+}
+
 TEST_F(HeapTest, ContainsSlow) {
   Isolate* iso = isolate();
   ManualGCScope manual_gc_scope(iso);
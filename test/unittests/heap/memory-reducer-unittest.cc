@@ -3,9 +3,16 @@
 // found in the LICENSE file.
 
 #include <limits>
+#include <vector>
 
+#include "include/libplatform/libplatform.h"
+#include "src/execution/isolate.h"
 #include "src/flags/flags.h"
+#include "src/heap/heap.h"
 #include "src/heap/memory-reducer.h"
+#include "src/init/isolate-group.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace v8 {
@@ -334,5 +341,85 @@ TEST(MemoryReducer, FromRunToDoneFrozen) {
   EXPECT_EQ(MemoryReducer::kDone, state1.id());
 }
 
+namespace {
+
+Heap* FakeHeap(uintptr_t id) { return reinterpret_cast<Heap*>(id); }
+
+}  // namespace
+
+TEST(GroupMemoryReducer, SelectNothingWithinBudget) {
+  std::vector<GroupMemoryReducer::Candidate> candidates = {
+      {FakeHeap(1), 10 * MB}, {FakeHeap(2), 20 * MB}};
+  EXPECT_TRUE(
+      GroupMemoryReducer::SelectHeapsToReduce(candidates, 100 * MB, 100 * MB)
+          .empty());
+}
+
+TEST(GroupMemoryReducer, SelectLargestFirst) {
+  std::vector<GroupMemoryReducer::Candidate> candidates = {
+      {FakeHeap(1), 10 * MB}, {FakeHeap(2), 30 * MB}, {FakeHeap(3), 20 * MB}};
+  std::vector<Heap*> selected =
+      GroupMemoryReducer::SelectHeapsToReduce(candidates, 125 * MB, 100 * MB);
+  ASSERT_EQ(1u, selected.size());
+  EXPECT_EQ(FakeHeap(2), selected[0]);
+}
+
+TEST(GroupMemoryReducer, SelectUntilExcessIsCovered) {
+  std::vector<GroupMemoryReducer::Candidate> candidates = {
+      {FakeHeap(1), 10 * MB}, {FakeHeap(2), 30 * MB}, {FakeHeap(3), 20 * MB}};
+  std::vector<Heap*> selected =
+      GroupMemoryReducer::SelectHeapsToReduce(candidates, 145 * MB, 100 * MB);
+  ASSERT_EQ(2u, selected.size());
+  EXPECT_EQ(FakeHeap(2), selected[0]);
+  EXPECT_EQ(FakeHeap(3), selected[1]);
+}
+
+TEST(GroupMemoryReducer, SelectAllIfExcessCannotBeCovered) {
+  std::vector<GroupMemoryReducer::Candidate> candidates = {
+      {FakeHeap(1), 10 * MB}, {FakeHeap(2), 30 * MB}};
+  std::vector<Heap*> selected =
+      GroupMemoryReducer::SelectHeapsToReduce(candidates, 200 * MB, 100 * MB);
+  ASSERT_EQ(2u, selected.size());
+  EXPECT_EQ(FakeHeap(2), selected[0]);
+  EXPECT_EQ(FakeHeap(1), selected[1]);
+}
+
+using GroupMemoryReducerWithIsolatesTest = TestWithPlatform;
+
+TEST_F(GroupMemoryReducerWithIsolatesTest, ReducesIdleIsolateOverBudget) {
+  if (!v8_flags.memory_reducer || !v8_flags.incremental_marking) return;
+  FlagScope<bool> group_memory_reducer(&v8_flags.group_memory_reducer, true);
+  // Any two heaps exceed a budget of 1MB.
+  FlagScope<size_t> budget(&v8_flags.group_memory_reducer_budget, 1);
+  IsolateWrapper idle_isolate(kNoCounters);
+  IsolateWrapper active_isolate(kNoCounters);
+  Heap* idle_heap = idle_isolate.i_isolate()->heap();
+  Heap* active_heap = active_isolate.i_isolate()->heap();
+  IsolateGroup* group = idle_isolate.i_isolate()->isolate_group();
+  ASSERT_EQ(group, active_isolate.i_isolate()->isolate_group());
+  GroupMemoryReducer* reducer = group->group_memory_reducer();
+
+  // Let the memory reducers of both heaps report their state, so that only the
+  // idle heap is a candidate for a memory-reducing GC.
+  reducer->NotifyHeapState(active_heap, active_heap->CommittedMemory(), false);
+  const unsigned int idle_gcs = idle_heap->ms_count();
+  const unsigned int active_gcs = active_heap->ms_count();
+  reducer->NotifyHeapState(idle_heap, idle_heap->CommittedMemory(), true);
+
+  {
+    v8::Isolate::Scope isolate_scope(idle_isolate.isolate());
+    while (v8::platform::PumpMessageLoop(platform(), idle_isolate.isolate())) {
+    }
+  }
+  {
+    v8::Isolate::Scope isolate_scope(active_isolate.isolate());
+    while (
+        v8::platform::PumpMessageLoop(platform(), active_isolate.isolate())) {
+    }
+  }
+  EXPECT_LT(idle_gcs, idle_heap->ms_count());
+  EXPECT_EQ(active_gcs, active_heap->ms_count());
+}
+
 }  // namespace internal
 }  // namespace v8
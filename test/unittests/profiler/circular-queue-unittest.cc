@@ -3,6 +3,10 @@
 // found in the LICENSE file.
 
 // Tests of the circular queue.
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include "src/init/v8.h"
 #include "src/profiler/circular-queue-inl.h"
 #include "test/unittests/test-utils.h"
@@ -14,7 +18,7 @@ using CircularQueueTest = ::testing::Test;
 TEST_F(CircularQueueTest, SamplingCircularQueue) {
   using Record = v8::base::AtomicWord;
   const int kMaxRecordsInQueue = 4;
-  SamplingCircularQueue<Record, kMaxRecordsInQueue> scq;
+  SamplingCircularQueue<Record> scq(kMaxRecordsInQueue);
 
   // Check that we are using non-reserved values.
   // Fill up the first chunk.
@@ -23,7 +27,7 @@ TEST_F(CircularQueueTest, SamplingCircularQueue) {
     Record* rec = reinterpret_cast<Record*>(scq.StartEnqueue());
     CHECK(rec);
     *rec = i;
-    scq.FinishEnqueue();
+    scq.FinishEnqueue(rec);
   }
 
   // The queue is full, enqueue is not allowed.
@@ -54,7 +58,7 @@ TEST_F(CircularQueueTest, SamplingCircularQueue) {
     Record* rec = reinterpret_cast<Record*>(scq.StartEnqueue());
     CHECK(rec);
     *rec = i;
-    scq.FinishEnqueue();
+    scq.FinishEnqueue(rec);
   }
 
   // Consume all available kMaxRecordsInQueue / 2 records.
@@ -75,7 +79,7 @@ TEST_F(CircularQueueTest, SamplingCircularQueue) {
 namespace {
 
 using Record = v8::base::AtomicWord;
-using TestSampleQueue = SamplingCircularQueue<Record, 12>;
+using TestSampleQueue = SamplingCircularQueue<Record>;
 
 class ProducerThread : public v8::base::Thread {
  public:
@@ -92,7 +96,7 @@ class ProducerThread : public v8::base::Thread {
       Record* rec = reinterpret_cast<Record*>(scq_->StartEnqueue());
       CHECK(rec);
       *rec = i;
-      scq_->FinishEnqueue();
+      scq_->FinishEnqueue(rec);
     }
 
     finished_->Signal();
@@ -114,7 +118,7 @@ TEST_F(CircularQueueTest, SamplingCircularQueueMultithreading) {
   // does sampling is called in the context of different VM threads.
 
   const int kRecordsPerChunk = 4;
-  TestSampleQueue scq;
+  TestSampleQueue scq(12);
   v8::base::Semaphore semaphore(0);
 
   ProducerThread producer1(&scq, kRecordsPerChunk, 1, &semaphore);
@@ -159,3 +163,69 @@ TEST_F(CircularQueueTest, SamplingCircularQueueMultithreading) {
 
   CHECK(!scq.Peek());
 }
+
+namespace {
+
+class ConcurrentProducerThread : public v8::base::Thread {
+ public:
+  ConcurrentProducerThread(TestSampleQueue* scq, int records, Record first,
+                           std::atomic<int>* dropped)
+      : Thread(Options("producer")),
+        scq_(scq),
+        records_(records),
+        first_(first),
+        dropped_(dropped) {}
+
+  void Run() override {
+    for (Record i = first_; i < first_ + records_; ++i) {
+      Record* rec = scq_->StartEnqueue();
+      if (rec == nullptr) {
+        dropped_->fetch_add(1);
+        continue;
+      }
+      *rec = i;
+      scq_->FinishEnqueue(rec);
+    }
+  }
+
+ private:
+  TestSampleQueue* scq_;
+  const int records_;
+  const Record first_;
+  std::atomic<int>* dropped_;
+};
+
+}  // namespace
+
+TEST_F(CircularQueueTest, SamplingCircularQueueConcurrentProducers) {
+  // Producers enqueue at the same time while the consumer drains the queue.
+  // Every record is either consumed exactly once or accounted as dropped,
+  // and each producer's records are consumed in order.
+  const int kProducers = 4;
+  const int kRecordsPerProducer = 10000;
+  const Record kProducerStride = 1000000;
+  TestSampleQueue scq(16);
+  std::atomic<int> dropped{0};
+  std::vector<std::unique_ptr<ConcurrentProducerThread>> producers;
+  for (int i = 0; i < kProducers; ++i) {
+    producers.push_back(std::make_unique<ConcurrentProducerThread>(
+        &scq, kRecordsPerProducer, (i + 1) * kProducerStride, &dropped));
+  }
+  for (auto& producer : producers) CHECK(producer->Start());
+
+  std::vector<Record> last(kProducers, 0);
+  int consumed = 0;
+  while (consumed + dropped.load() < kProducers * kRecordsPerProducer) {
+    Record* rec = scq.Peek();
+    if (rec == nullptr) continue;
+    int producer = static_cast<int>(*rec / kProducerStride) - 1;
+    CHECK_LE(0, producer);
+    CHECK_LT(producer, kProducers);
+    CHECK_LT(last[producer], *rec);
+    last[producer] = *rec;
+    scq.Remove();
+    consumed++;
+  }
+  for (auto& producer : producers) producer->Join();
+  CHECK(!scq.Peek());
+}